@@ -0,0 +1,1744 @@
+/*
+* File Name: linked_list_benchmark.c
+* Purpose: Contains the benchmark program for my linked list implementation,
+*          which times synthetic workloads for every operation in
+*          linked_list.h and reports the results as text and JSON.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Request the POSIX declarations, which strict ISO C builds hide.  This has to
+// come before the first header is included.
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+// Include the headers for the linked list and the generated 64-bit list.
+#include "../LinkedList/linked_list.h"
+#include "../LinkedList/int64_linked_list.h"
+#include "../LinkedList/concurrent_linked_list.h"
+#include "../LinkedList/locked_linked_list.h"
+#include "../LinkedList/compact_linked_list.h"
+#include "../LinkedList/integer_stream.h"
+#include "../LinkedList/journaled_linked_list.h"
+#include "../LinkedList/persistent_linked_list.h"
+
+// Include the header for the threads of the contention workloads.
+#include "../LinkedList/platform_thread.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include the platform headers which provide timers and memory usage.
+// Conditional compilation for Windows environment.
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#include <psapi.h>
+// Conditional compilation for Unix environment.
+#else
+#include <sys/resource.h>
+#include <time.h>
+// End conditional compilation.
+#endif
+
+// Defines the default number of elements each workload operates on.
+#define DEFAULT_SIZE 1000000
+
+// Defines the default number of times each workload is repeated, the fastest
+// repetition is reported.
+#define DEFAULT_REPEAT 3
+
+// Defines the largest number of random index lookups or removals performed by
+// a single workload, each of which walks a large part of the list.
+#define MAXIMUM_RANDOM_ACCESSES 2000
+
+// Defines the largest number of random insertions or searches performed by
+// the sorted mode workloads, each of which walks a large part of the list.
+#define MAXIMUM_SORTED_ACCESSES 200
+
+// Defines the value planted in lists by the remove_value and find workloads,
+// chosen outside the range of the generated values.
+#define TARGET_VALUE -1
+
+// Defines the largest number of threads used by the contention workloads.
+#define MAXIMUM_QUEUE_THREADS 32
+
+// Defines the number of elements the shared list of the mixed workloads starts
+// with, and the largest number of operations one of them performs.  Every
+// operation walks part of the list.
+#define MIXED_LIST_SIZE 1000
+#define MAXIMUM_MIXED_OPERATIONS 20000
+
+// Defines the maximum number of results a single run can collect.
+#define MAXIMUM_RESULTS 128
+
+// Settings and shared state of a benchmark run.
+// Contains:
+// - Number of elements each workload operates on.
+// - Number of repetitions of each workload.
+// - Directory used for the files of the I/O workloads.
+// - Start time of the timed section of the current repetition.
+// - Duration of the timed section of the current repetition.
+// - State of the generator for random values and indices.
+typedef struct BenchmarkContext
+{
+    size_t size;
+    int repeat;
+    char const *directory;
+    unsigned long long startNanoseconds;
+    unsigned long long elapsedNanoseconds;
+    unsigned long long randomState;
+} BenchmarkContext;
+
+// Measurement of a single workload.
+// Contains:
+// - Name of the workload.
+// - Number of operations performed by one repetition.
+// - Duration of the fastest repetition.
+// - Peak resident memory of the process after the workload.
+typedef struct BenchmarkResult
+{
+    char const *name;
+    size_t operations;
+    unsigned long long nanoseconds;
+    size_t peakResidentKilobytes;
+} BenchmarkResult;
+
+// A workload, which runs once and returns the number of operations it timed.
+typedef size_t (*BenchmarkFunction)(BenchmarkContext *context);
+
+// Description of a workload.
+// Contains:
+// - Name reported for the workload.
+// - Function running one repetition of it.
+typedef struct BenchmarkCase
+{
+    char const *name;
+    BenchmarkFunction run;
+} BenchmarkCase;
+
+// Returns a monotonic timestamp in nanoseconds.
+static unsigned long long now_nanoseconds(void)
+{
+// Conditional compilation for Windows environment.
+#if defined(_WIN32) || defined(_WIN64)
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (unsigned long long)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+// Conditional compilation for Unix environment.
+#else
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (unsigned long long)time.tv_sec * 1000000000ULL + (unsigned long long)time.tv_nsec;
+// End conditional compilation.
+#endif
+}
+
+// Returns the peak resident memory of the process in kilobytes.
+static size_t peak_resident_kilobytes(void)
+{
+// Conditional compilation for Windows environment.
+#if defined(_WIN32) || defined(_WIN64)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) { return 0; }
+    return (size_t)(counters.PeakWorkingSetSize / 1024);
+// Conditional compilation for Unix environment.
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) { return 0; }
+// macOS reports bytes, Linux reports kilobytes.
+#if defined(__APPLE__)
+    return (size_t)usage.ru_maxrss / 1024;
+#else
+    return (size_t)usage.ru_maxrss;
+#endif
+// End conditional compilation.
+#endif
+}
+
+// Starts the timed section of a workload, everything before is setup.
+static void timer_start(BenchmarkContext *context)
+{
+    context->startNanoseconds = now_nanoseconds();
+}
+
+// Ends the timed section of a workload, everything after is teardown.
+static void timer_stop(BenchmarkContext *context)
+{
+    context->elapsedNanoseconds = now_nanoseconds() - context->startNanoseconds;
+}
+
+// Returns the next pseudo random number, using a xorshift generator so that
+// every run generates the same workloads.
+static unsigned long long next_random(BenchmarkContext *context)
+{
+    unsigned long long state = context->randomState;
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    context->randomState = state;
+    return state * 0x2545F4914F6CDD1DULL;
+}
+
+// Returns a random, non-negative, value to store in a list.
+static int random_value(BenchmarkContext *context)
+{
+    return (int)(next_random(context) >> 34);
+}
+
+// Initializes a list, exiting the program if that fails.
+static void create_list(IntegerLinkedList *list)
+{
+    if (!linked_list_initialize(list))
+    {
+        fprintf(stderr, "Failed to initialize the list!\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+// Initializes a list and fills it with `size` random values.
+static void create_filled_list(BenchmarkContext *context, IntegerLinkedList *list, size_t const size)
+{
+    create_list(list);
+    for (size_t i = 0; i < size; ++i) { linked_list_push_back(list, random_value(context)); }
+}
+
+// Initializes a list of random values in which roughly `hitsPerThousand` of
+// every thousand elements are TARGET_VALUE.
+static void create_list_with_hits(BenchmarkContext *context, IntegerLinkedList *list,
+                                  unsigned const hitsPerThousand)
+{
+    create_list(list);
+    for (size_t i = 0; i < context->size; ++i)
+    {
+        bool const hit = next_random(context) % 1000 < hitsPerThousand;
+        linked_list_push_back(list, hit ? TARGET_VALUE : random_value(context));
+    }
+}
+
+// Builds the path of a file in the benchmark directory.
+static void benchmark_path(BenchmarkContext const *context, char *buffer, size_t const length,
+                           char const *name)
+{
+    snprintf(buffer, length, "%s/%s", context->directory, name);
+}
+
+// Returns the number of random accesses used by the workloads that walk the
+// list for every access.
+static size_t random_access_count(BenchmarkContext const *context)
+{
+    return context->size < MAXIMUM_RANDOM_ACCESSES ? context->size : MAXIMUM_RANDOM_ACCESSES;
+}
+
+// Workload: append every element with push_back().
+static size_t bench_push_back(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_list(&list);
+
+    timer_start(context);
+    for (size_t i = 0; i < context->size; ++i) { linked_list_push_back(&list, (int)i); }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: prepend every element with push_front().
+static size_t bench_push_front(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_list(&list);
+
+    timer_start(context);
+    for (size_t i = 0; i < context->size; ++i) { linked_list_push_front(&list, (int)i); }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Allocates an array of `size` random values, exiting the program if that
+// fails.
+static int *create_random_array(BenchmarkContext *context, size_t const size)
+{
+    int *values = (int *)malloc(size * sizeof(int));
+    if (!values)
+    {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (size_t i = 0; i < size; ++i) { values[i] = random_value(context); }
+    return values;
+}
+
+// Workload: append every element with a single push_back_array().
+static size_t bench_push_back_array(BenchmarkContext *context)
+{
+    int *values = create_random_array(context, context->size);
+    IntegerLinkedList list;
+    create_list(&list);
+
+    timer_start(context);
+    linked_list_push_back_array(&list, values, context->size);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    free(values);
+    return context->size;
+}
+
+// Workload: prepend every element with a single push_front_array().
+static size_t bench_push_front_array(BenchmarkContext *context)
+{
+    int *values = create_random_array(context, context->size);
+    IntegerLinkedList list;
+    create_list(&list);
+
+    timer_start(context);
+    linked_list_push_front_array(&list, values, context->size);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    free(values);
+    return context->size;
+}
+
+// Workload: copy every element into an array with export_array().
+static size_t bench_export_array(BenchmarkContext *context)
+{
+    int *values = create_random_array(context, context->size);
+    IntegerLinkedList list;
+    create_list(&list);
+    linked_list_push_back_array(&list, values, context->size);
+
+    timer_start(context);
+    linked_list_export_array(&list, values, context->size);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    free(values);
+    return context->size;
+}
+
+// Workload: append every element to a generated list of 64-bit integers,
+// which stores each element inline in its node like IntegerLinkedList.
+static size_t bench_int64_push_back(BenchmarkContext *context)
+{
+    Int64LinkedList list;
+    int64_list_initialize(&list);
+
+    timer_start(context);
+    for (size_t i = 0; i < context->size; ++i) { int64_list_push_back(&list, (int64_t)i << 32); }
+    timer_stop(context);
+
+    int64_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: empty a full list with pop_back().
+static size_t bench_pop_back(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    timer_start(context);
+    for (size_t i = 0; i < context->size; ++i) { linked_list_pop_back(&list); }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: empty a full list with pop_front().
+static size_t bench_pop_front(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    timer_start(context);
+    for (size_t i = 0; i < context->size; ++i) { linked_list_pop_front(&list); }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: use a full list as a queue, each operation pops the front and
+// pushes a new value to the back, recycling nodes constantly.
+static size_t bench_pop_churn(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    timer_start(context);
+    for (size_t i = 0; i < context->size; ++i)
+    {
+        linked_list_pop_front(&list);
+        linked_list_push_back(&list, (int)i);
+    }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: read every element in index order with element_at().
+static size_t bench_element_at_sequential(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    volatile long long sink = 0;
+    timer_start(context);
+    for (size_t i = 0; i < context->size; ++i) { sink += linked_list_element_at(&list, i); }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: read elements at random indices with element_at().
+static size_t bench_element_at_random(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+    size_t const accesses = random_access_count(context);
+
+    volatile long long sink = 0;
+    timer_start(context);
+    for (size_t i = 0; i < accesses; ++i)
+    {
+        sink += linked_list_element_at(&list, (size_t)(next_random(context) % list.size));
+    }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return accesses;
+}
+
+// Workload: remove elements at random indices with remove_at_index().
+static size_t bench_remove_at_index(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+    size_t const removals = random_access_count(context);
+
+    timer_start(context);
+    for (size_t i = 0; i < removals; ++i)
+    {
+        linked_list_remove_at_index(&list, (size_t)(next_random(context) % list.size));
+    }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return removals;
+}
+
+// Shared body of the remove_value() workloads, operations are the elements
+// examined by the single call.
+static size_t bench_remove_value(BenchmarkContext *context, unsigned const hitsPerThousand)
+{
+    IntegerLinkedList list;
+    create_list_with_hits(context, &list, hitsPerThousand);
+
+    timer_start(context);
+    linked_list_remove_value(&list, TARGET_VALUE);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: remove_value() of a value which is not in the list.
+static size_t bench_remove_value_miss(BenchmarkContext *context)
+{
+    return bench_remove_value(context, 0);
+}
+
+// Workload: remove_value() of a value stored by 1% of the elements.
+static size_t bench_remove_value_1_percent(BenchmarkContext *context)
+{
+    return bench_remove_value(context, 10);
+}
+
+// Workload: remove_value() of a value stored by half of the elements.
+static size_t bench_remove_value_50_percent(BenchmarkContext *context)
+{
+    return bench_remove_value(context, 500);
+}
+
+// Defines the number of distinct values removed by the remove_values workload.
+#define REMOVED_VALUE_COUNT 16
+
+// Initializes a list of values drawn from a small range, so that every value
+// is stored many times.
+static void create_list_of_small_values(BenchmarkContext *context, IntegerLinkedList *list)
+{
+    create_list(list);
+    for (size_t i = 0; i < context->size; ++i)
+    {
+        linked_list_push_back(list, (int)(next_random(context) % 1024));
+    }
+}
+
+// Workload: remove_values() of REMOVED_VALUE_COUNT values in one call,
+// operations are the elements examined.
+static size_t bench_remove_values(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_list_of_small_values(context, &list);
+
+    int values[REMOVED_VALUE_COUNT];
+    for (int i = 0; i < REMOVED_VALUE_COUNT; ++i) { values[i] = i * 64; }
+
+    timer_start(context);
+    linked_list_remove_values(&list, values, REMOVED_VALUE_COUNT);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Predicate matching odd values, for the remove_if workload.
+static bool is_odd(int const value, void *context)
+{
+    (void)context;
+    return value & 1;
+}
+
+// Workload: remove_if() of every odd value, operations are the elements
+// examined.
+static size_t bench_remove_if(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_list_of_small_values(context, &list);
+
+    timer_start(context);
+    linked_list_remove_if(&list, is_odd, NULL);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: find_first_index_containing() of a value which is not in the
+// list, operations are the elements examined.
+static size_t bench_find_miss(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    volatile size_t sink = 0;
+    timer_start(context);
+    sink += linked_list_find_first_index_containing(&list, TARGET_VALUE);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: contains() lookups of random values against a value index.
+static size_t bench_contains_indexed(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+    linked_list_enable_value_index(&list);
+
+    // Build the index outside of the timed section.
+    volatile size_t sink = linked_list_contains(&list, TARGET_VALUE);
+    timer_start(context);
+    for (size_t i = 0; i < context->size; ++i)
+    {
+        sink += linked_list_contains(&list, random_value(context));
+    }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: replace the oldest element with a random value, then poll the
+// sum, minimum and maximum, with the aggregates kept up to date.
+static size_t bench_aggregates_poll(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+    linked_list_enable_aggregates(&list);
+
+    // Build the aggregates outside of the timed section.
+    volatile long long sink = linked_list_sum(&list);
+    int minimum = 0;
+    int maximum = 0;
+
+    timer_start(context);
+    for (size_t i = 0; i < context->size; ++i)
+    {
+        linked_list_pop_front(&list);
+        linked_list_push_back(&list, random_value(context));
+        linked_list_minimum(&list, &minimum);
+        linked_list_maximum(&list, &maximum);
+        sink += linked_list_sum(&list) + minimum + maximum;
+    }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: the same polling as aggregates_poll, traversing the list for
+// every poll, so only a limited number of polls are made.
+static size_t bench_traversal_poll(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    size_t const polls = context->size < MAXIMUM_RANDOM_ACCESSES ? context->size
+                                                                 : MAXIMUM_RANDOM_ACCESSES;
+    volatile long long sink = 0;
+    int minimum = 0;
+    int maximum = 0;
+
+    timer_start(context);
+    for (size_t i = 0; i < polls; ++i)
+    {
+        linked_list_pop_front(&list);
+        linked_list_push_back(&list, random_value(context));
+        linked_list_minimum(&list, &minimum);
+        linked_list_maximum(&list, &maximum);
+        sink += linked_list_sum(&list) + minimum + maximum;
+    }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return polls;
+}
+
+// Workload: walk the whole list forward with an iterator.
+static size_t bench_iterate(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    volatile long long sink = 0;
+    timer_start(context);
+    for (IntegerListIterator iterator = linked_list_iterator_first(&list);
+         linked_list_iterator_valid(&iterator); linked_list_iterator_next(&iterator))
+    {
+        sink += linked_list_iterator_value(&iterator);
+    }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: sum a full list with parallel_sum(), one thread per processor.
+// The segments of the list are computed by the timed call.
+static size_t bench_parallel_sum(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    volatile long long sink = 0;
+    timer_start(context);
+    sink += linked_list_parallel_sum(&list, 0);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: parallel_find_first_index_containing() of a value that is not in
+// the list, after a first search computed the segments of the list.
+static size_t bench_parallel_find_miss(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    volatile size_t sink = linked_list_parallel_find_first_index_containing(&list, TARGET_VALUE, 0);
+    timer_start(context);
+    sink += linked_list_parallel_find_first_index_containing(&list, TARGET_VALUE, 0);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Fills a compact list with `size` random values pushed to the back.
+static void create_filled_compact_list(BenchmarkContext *context, CompactIntegerList *list,
+                                       size_t const size)
+{
+    compact_list_initialize(list);
+    for (size_t i = 0; i < size; ++i) { compact_list_push_back(list, random_value(context)); }
+}
+
+// Workload: push_back() into a compact list, whose nodes take half the memory.
+static size_t bench_compact_push_back(BenchmarkContext *context)
+{
+    CompactIntegerList list;
+    compact_list_initialize(&list);
+
+    timer_start(context);
+    for (size_t i = 0; i < context->size; ++i) { compact_list_push_back(&list, (int)i); }
+    timer_stop(context);
+
+    compact_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: iterate a full compact list from front to back.
+static size_t bench_compact_iterate(BenchmarkContext *context)
+{
+    CompactIntegerList list;
+    create_filled_compact_list(context, &list, context->size);
+
+    volatile long long sink = 0;
+    timer_start(context);
+    for (CompactListIterator iterator = compact_list_iterator_first(&list);
+         compact_list_iterator_valid(&iterator); compact_list_iterator_next(&iterator))
+    {
+        sink += compact_list_iterator_value(&iterator);
+    }
+    timer_stop(context);
+
+    compact_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: find_first_index_containing() of a value that is not in a full
+// compact list.
+static size_t bench_compact_find_miss(BenchmarkContext *context)
+{
+    CompactIntegerList list;
+    create_filled_compact_list(context, &list, context->size);
+
+    volatile size_t sink = 0;
+    timer_start(context);
+    sink += compact_list_find_first_index_containing(&list, TARGET_VALUE);
+    timer_stop(context);
+
+    compact_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: push_back() on the persistent list.
+static size_t bench_persistent_push_back(BenchmarkContext *context)
+{
+    PersistentIntegerList list;
+    persistent_list_initialize(&list);
+
+    timer_start(context);
+    for (size_t i = 0; i < context->size; ++i)
+    {
+        persistent_list_push_back(&list, random_value(context));
+    }
+    timer_stop(context);
+
+    persistent_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: take a snapshot of a full persistent list, then replace its
+// oldest element while the snapshot is held, copying the nodes it shares.
+static size_t bench_persistent_snapshot_write(BenchmarkContext *context)
+{
+    PersistentIntegerList list;
+    persistent_list_initialize(&list);
+    for (size_t i = 0; i < context->size; ++i)
+    {
+        persistent_list_push_back(&list, random_value(context));
+    }
+
+    timer_start(context);
+    for (size_t i = 0; i < context->size; ++i)
+    {
+        PersistentListSnapshot snapshot = persistent_list_snapshot(&list);
+        persistent_list_pop_front(&list);
+        persistent_list_push_back(&list, random_value(context));
+        persistent_snapshot_release(&snapshot);
+    }
+    timer_stop(context);
+
+    persistent_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: the deep copy of a full list that snapshots replace, so only a
+// limited number of copies are made.
+static size_t bench_deep_copy(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    size_t const copies = context->size < MAXIMUM_SORTED_ACCESSES ? context->size
+                                                                  : MAXIMUM_SORTED_ACCESSES;
+
+    timer_start(context);
+    for (size_t i = 0; i < copies; ++i)
+    {
+        IntegerLinkedList copy;
+        create_list(&copy);
+        for (IntegerListIterator iterator = linked_list_iterator_first(&list);
+             linked_list_iterator_valid(&iterator); linked_list_iterator_next(&iterator))
+        {
+            linked_list_push_back(&copy, linked_list_iterator_value(&iterator));
+        }
+        linked_list_cleanup(&copy);
+    }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return copies;
+}
+
+// Workload: concat() two lists holding half of the elements each, a single
+// operation which relinks the lists instead of moving the elements.
+static size_t bench_concat(BenchmarkContext *context)
+{
+    IntegerLinkedList first;
+    IntegerLinkedList second;
+    create_filled_list(context, &first, context->size / 2);
+    create_filled_list(context, &second, context->size - context->size / 2);
+
+    timer_start(context);
+    linked_list_concat(&first, &second);
+    timer_stop(context);
+
+    linked_list_cleanup(&second);
+    linked_list_cleanup(&first);
+    return 1;
+}
+
+// Workload: split() a full list in half, a single operation which only walks
+// to the split point.
+static size_t bench_split(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    IntegerLinkedList tail;
+    create_filled_list(context, &list, context->size);
+    create_list(&tail);
+
+    timer_start(context);
+    linked_list_split(&list, context->size / 2, &tail);
+    timer_stop(context);
+
+    linked_list_cleanup(&tail);
+    linked_list_cleanup(&list);
+    return 1;
+}
+
+// Workload: sort() a list of random values in place.
+static size_t bench_sort(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    timer_start(context);
+    linked_list_sort(&list);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Comparison function for qsort(), ordering integers ascending.
+static int compare_integers(void const *left, void const *right)
+{
+    int const a = *(int const *)left;
+    int const b = *(int const *)right;
+    return (a > b) - (a < b);
+}
+
+// Workload: sort a list of random values the way consumers did before sort()
+// existed, copying it into an array, sorting the array with qsort(), and
+// rebuilding the list from it.
+static size_t bench_sort_by_copy(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    timer_start(context);
+    int *values = (int *)malloc(list.size * sizeof(int));
+    if (!values)
+    {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(EXIT_FAILURE);
+    }
+    size_t const count = linked_list_export_array(&list, values, list.size);
+    qsort(values, count, sizeof(int), compare_integers);
+    linked_list_clear(&list);
+    linked_list_push_back_array(&list, values, count);
+    free(values);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: push_back() random values into a full list in sorted mode, each
+// of which is inserted in its place.
+static size_t bench_sorted_insert(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+    linked_list_set_sorted(&list, true);
+    linked_list_compact(&list);
+    size_t const inserts = context->size < MAXIMUM_SORTED_ACCESSES ? context->size
+                                                                   : MAXIMUM_SORTED_ACCESSES;
+
+    timer_start(context);
+    for (size_t i = 0; i < inserts; ++i) { linked_list_push_back(&list, random_value(context)); }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return inserts;
+}
+
+// Workload: find_first_index_containing() of random values, which are almost
+// never in a full list in sorted mode, so each search stops at the first
+// larger value instead of walking the whole list.
+static size_t bench_sorted_find_miss(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+    linked_list_set_sorted(&list, true);
+    linked_list_compact(&list);
+    size_t const searches = context->size < MAXIMUM_SORTED_ACCESSES ? context->size
+                                                                    : MAXIMUM_SORTED_ACCESSES;
+
+    volatile size_t sink = 0;
+    timer_start(context);
+    for (size_t i = 0; i < searches; ++i)
+    {
+        sink += linked_list_find_first_index_containing(&list, random_value(context));
+    }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return searches;
+}
+
+// State of one thread of the queue contention workloads.
+// Contains:
+// - Concurrent list the thread uses, or null when it uses the locked list.
+// - Locked list the thread uses, and the mutex guarding it.
+// - Number of push and pop pairs the thread performs.
+typedef struct QueueWorker
+{
+    ConcurrentIntegerList *concurrent;
+    IntegerLinkedList *locked;
+    PlatformMutex *mutex;
+    size_t pairs;
+} QueueWorker;
+
+// Thread of the queue contention workloads, pushing values to the back of
+// the shared queue and popping values from its front.
+static void queue_worker(void *argument)
+{
+    QueueWorker *worker = (QueueWorker *)argument;
+
+    if (worker->concurrent)
+    {
+        ConcurrentListHandle handle;
+        if (!concurrent_list_attach(worker->concurrent, &handle)) { return; }
+
+        int value;
+        for (size_t i = 0; i < worker->pairs; ++i)
+        {
+            concurrent_list_push_back(&handle, (int)i);
+            concurrent_list_try_pop_front(&handle, &value);
+        }
+
+        concurrent_list_detach(&handle);
+        return;
+    }
+
+    // The locked queue takes the mutex for every call, as a work queue
+    // shared through a global mutex does.
+    for (size_t i = 0; i < worker->pairs; ++i)
+    {
+        platform_mutex_lock(worker->mutex);
+        linked_list_push_back(worker->locked, (int)i);
+        platform_mutex_unlock(worker->mutex);
+
+        platform_mutex_lock(worker->mutex);
+        linked_list_pop_front(worker->locked);
+        platform_mutex_unlock(worker->mutex);
+    }
+}
+
+// Workload: `threadCount` threads share one queue, together pushing and
+// popping `size` values, either through the lock-free concurrent list or
+// through a list guarded by a mutex.  Thread start up is timed as well.
+static size_t bench_queue(BenchmarkContext *context, size_t const threadCount, bool const lockFree)
+{
+    ConcurrentIntegerList concurrent;
+    IntegerLinkedList locked;
+    PlatformMutex mutex;
+    PlatformThread threads[MAXIMUM_QUEUE_THREADS];
+    QueueWorker workers[MAXIMUM_QUEUE_THREADS];
+    size_t const pairs = context->size / threadCount / 2 ? context->size / threadCount / 2 : 1;
+
+    if (lockFree)
+    {
+        concurrent_list_initialize(&concurrent);
+    }
+    else
+    {
+        create_list(&locked);
+        if (!platform_mutex_initialize(&mutex))
+        {
+            linked_list_cleanup(&locked);
+            return 0;
+        }
+    }
+
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        workers[i].concurrent = lockFree ? &concurrent : NULL;
+        workers[i].locked = &locked;
+        workers[i].mutex = &mutex;
+        workers[i].pairs = pairs;
+    }
+
+    // Threads that fail to start are skipped, and their operations with them.
+    size_t started = 0;
+    bool running[MAXIMUM_QUEUE_THREADS];
+
+    timer_start(context);
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        running[i] = platform_thread_start(&threads[i], queue_worker, &workers[i]);
+        if (running[i]) { ++started; }
+    }
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        if (running[i]) { platform_thread_join(&threads[i]); }
+    }
+    timer_stop(context);
+
+    if (lockFree)
+    {
+        concurrent_list_cleanup(&concurrent);
+    }
+    else
+    {
+        platform_mutex_cleanup(&mutex);
+        linked_list_cleanup(&locked);
+    }
+
+    return started * pairs * 2;
+}
+
+// Workloads: the queue contention workload at each thread count.
+static size_t bench_concurrent_queue_1(BenchmarkContext *context) { return bench_queue(context, 1, true); }
+static size_t bench_concurrent_queue_2(BenchmarkContext *context) { return bench_queue(context, 2, true); }
+static size_t bench_concurrent_queue_4(BenchmarkContext *context) { return bench_queue(context, 4, true); }
+static size_t bench_concurrent_queue_8(BenchmarkContext *context) { return bench_queue(context, 8, true); }
+static size_t bench_concurrent_queue_16(BenchmarkContext *context) { return bench_queue(context, 16, true); }
+static size_t bench_concurrent_queue_32(BenchmarkContext *context) { return bench_queue(context, 32, true); }
+static size_t bench_mutex_queue_1(BenchmarkContext *context) { return bench_queue(context, 1, false); }
+static size_t bench_mutex_queue_2(BenchmarkContext *context) { return bench_queue(context, 2, false); }
+static size_t bench_mutex_queue_4(BenchmarkContext *context) { return bench_queue(context, 4, false); }
+static size_t bench_mutex_queue_8(BenchmarkContext *context) { return bench_queue(context, 8, false); }
+static size_t bench_mutex_queue_16(BenchmarkContext *context) { return bench_queue(context, 16, false); }
+static size_t bench_mutex_queue_32(BenchmarkContext *context) { return bench_queue(context, 32, false); }
+
+// State of one thread of the mixed workloads.
+// Contains:
+// - List with a lock per node the thread uses, or null when it uses the
+//   locked list.
+// - List guarded by a single mutex the thread uses, and that mutex.
+// - Number of operations the thread performs.
+// - First of the values the thread pushes, no other thread pushes them.
+// - State of the thread's generator for random values and indices.
+// - Number of nodes the thread pushed and, on the locked list, removed.
+typedef struct MixedWorker
+{
+    LockedIntegerList *fine;
+    IntegerLinkedList *coarse;
+    PlatformMutex *mutex;
+    size_t operations;
+    int firstValue;
+    unsigned long long randomState;
+    size_t pushed;
+    size_t removed;
+} MixedWorker;
+
+// Returns the next value of a worker's generator, see next_random().
+static unsigned long long mixed_random(MixedWorker *worker)
+{
+    worker->randomState ^= worker->randomState >> 12;
+    worker->randomState ^= worker->randomState << 25;
+    worker->randomState ^= worker->randomState >> 27;
+    return worker->randomState * 0x2545F4914F6CDD9DULL;
+}
+
+// Thread of the mixed workloads.  Half of the operations search for a value,
+// the rest push a new value, remove every node holding a value, or remove the
+// node at an index, all spread over the whole list.
+static void mixed_worker(void *argument)
+{
+    MixedWorker *worker = (MixedWorker *)argument;
+    int nextValue = worker->firstValue;
+
+    for (size_t i = 0; i < worker->operations; ++i)
+    {
+        unsigned long long const random = mixed_random(worker);
+        int const value = (int)((random >> 8) % (unsigned long long)(nextValue + 1));
+        size_t const index = (size_t)(random >> 8) % MIXED_LIST_SIZE;
+
+        if (worker->fine)
+        {
+            switch (random & 7)
+            {
+                case 0: locked_list_push_back(worker->fine, nextValue++); ++worker->pushed; break;
+                case 1: locked_list_push_front(worker->fine, nextValue++); ++worker->pushed; break;
+                case 2: worker->removed += locked_list_remove_value(worker->fine, value); break;
+                case 3: worker->removed += locked_list_remove_at_index(worker->fine, index); break;
+                default: locked_list_find_first_index_containing(worker->fine, value); break;
+            }
+            continue;
+        }
+
+        platform_mutex_lock(worker->mutex);
+        size_t const size = worker->coarse->size;
+        switch (random & 7)
+        {
+            case 0: linked_list_push_back(worker->coarse, nextValue++); ++worker->pushed; break;
+            case 1: linked_list_push_front(worker->coarse, nextValue++); ++worker->pushed; break;
+            case 2: linked_list_remove_value(worker->coarse, value); break;
+            case 3: if (index < size) { linked_list_remove_at_index(worker->coarse, index); } break;
+            default: linked_list_find_first_index_containing(worker->coarse, value); break;
+        }
+        platform_mutex_unlock(worker->mutex);
+    }
+}
+
+// Checks that the list with a lock per node still holds exactly the nodes
+// pushed and not removed, each value at most once, and that its size agrees.
+// Prints a diagnostic message and exits if it does not.
+static void verify_locked_list(LockedIntegerList *list, size_t const expected, int const valueCount)
+{
+    bool *seen = calloc((size_t)valueCount, sizeof(bool));
+    size_t counted = 0;
+
+    if (!seen)
+    {
+        fprintf(stderr, "Failed to allocate the values to verify!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (LockedNode *node = list->head.next; node; node = node->next, ++counted)
+    {
+        if (node->data < 0 || node->data >= valueCount || seen[node->data])
+        {
+            fprintf(stderr, "Locked list holds an unexpected value %d!\n", node->data);
+            exit(EXIT_FAILURE);
+        }
+        seen[node->data] = true;
+    }
+
+    free(seen);
+
+    if (counted != expected || locked_list_size(list) != expected)
+    {
+        fprintf(stderr, "Locked list holds %zu nodes and reports %zu, expected %zu!\n",
+                counted, locked_list_size(list), expected);
+        exit(EXIT_FAILURE);
+    }
+}
+
+// Workload: `threadCount` threads share one list of MIXED_LIST_SIZE values,
+// mixing searches with insertions and removals, either through the list with
+// a lock per node or through a list guarded by a single mutex.  The list with
+// a lock per node is verified afterwards, as a stress test of its locking.
+static size_t bench_mixed(BenchmarkContext *context, size_t const threadCount, bool const fine)
+{
+    LockedIntegerList locked;
+    IntegerLinkedList coarse;
+    PlatformMutex mutex;
+    PlatformThread threads[MAXIMUM_QUEUE_THREADS];
+    MixedWorker workers[MAXIMUM_QUEUE_THREADS];
+    bool running[MAXIMUM_QUEUE_THREADS];
+    size_t const total = context->size < MAXIMUM_MIXED_OPERATIONS ? context->size
+                                                                  : MAXIMUM_MIXED_OPERATIONS;
+    size_t const operations = total / threadCount ? total / threadCount : 1;
+
+    if (fine ? !locked_list_initialize(&locked) : !platform_mutex_initialize(&mutex))
+    {
+        return 0;
+    }
+
+    // Start with the values below MIXED_LIST_SIZE, each thread then pushes
+    // values from its own range after them.
+    if (!fine) { create_list(&coarse); }
+    for (int i = 0; i < MIXED_LIST_SIZE; ++i)
+    {
+        if (fine) { locked_list_push_back(&locked, i); }
+        else { linked_list_push_back(&coarse, i); }
+    }
+
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        workers[i].fine = fine ? &locked : NULL;
+        workers[i].coarse = &coarse;
+        workers[i].mutex = &mutex;
+        workers[i].operations = operations;
+        workers[i].firstValue = MIXED_LIST_SIZE + (int)(i * operations);
+        workers[i].randomState = next_random(context) | 1;
+        workers[i].pushed = 0;
+        workers[i].removed = 0;
+    }
+
+    size_t started = 0;
+
+    timer_start(context);
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        running[i] = platform_thread_start(&threads[i], mixed_worker, &workers[i]);
+        if (running[i]) { ++started; }
+    }
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        if (running[i]) { platform_thread_join(&threads[i]); }
+    }
+    timer_stop(context);
+
+    if (fine)
+    {
+        size_t expected = MIXED_LIST_SIZE;
+        for (size_t i = 0; i < threadCount; ++i)
+        {
+            expected += workers[i].pushed - workers[i].removed;
+        }
+
+        verify_locked_list(&locked, expected, MIXED_LIST_SIZE + (int)(threadCount * operations));
+        locked_list_cleanup(&locked);
+    }
+    else
+    {
+        linked_list_cleanup(&coarse);
+        platform_mutex_cleanup(&mutex);
+    }
+
+    return started * operations;
+}
+
+// Workloads: the mixed workload at each thread count.
+static size_t bench_locked_mixed_1(BenchmarkContext *context) { return bench_mixed(context, 1, true); }
+static size_t bench_locked_mixed_2(BenchmarkContext *context) { return bench_mixed(context, 2, true); }
+static size_t bench_locked_mixed_4(BenchmarkContext *context) { return bench_mixed(context, 4, true); }
+static size_t bench_locked_mixed_8(BenchmarkContext *context) { return bench_mixed(context, 8, true); }
+static size_t bench_mutex_mixed_1(BenchmarkContext *context) { return bench_mixed(context, 1, false); }
+static size_t bench_mutex_mixed_2(BenchmarkContext *context) { return bench_mixed(context, 2, false); }
+static size_t bench_mutex_mixed_4(BenchmarkContext *context) { return bench_mixed(context, 4, false); }
+static size_t bench_mutex_mixed_8(BenchmarkContext *context) { return bench_mixed(context, 8, false); }
+
+// Workload: clear a full list.
+static size_t bench_clear(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    timer_start(context);
+    linked_list_clear(&list);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Workload: compact a list whose nodes were scattered by mixed insertions.
+static size_t bench_compact(BenchmarkContext *context)
+{
+    IntegerLinkedList list;
+    create_list(&list);
+    for (size_t i = 0; i < context->size; ++i)
+    {
+        if (next_random(context) & 1)
+        {
+            linked_list_push_front(&list, (int)i);
+        }
+        else
+        {
+            linked_list_push_back(&list, (int)i);
+        }
+    }
+
+    timer_start(context);
+    linked_list_compact(&list);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    return context->size;
+}
+
+// Writes a text file with one random value per line, as read by
+// load_data_from_file().
+static void write_input_file(BenchmarkContext *context, char const *path)
+{
+    FILE *file = fopen(path, "w");
+    if (!file)
+    {
+        fprintf(stderr, "ERROR: Unable to create %s file.\n", path);
+        exit(EXIT_FAILURE);
+    }
+
+    for (size_t i = 0; i < context->size; ++i)
+    {
+        int const value = random_value(context);
+        fprintf(file, "%d\n", (next_random(context) & 1) ? value : -value);
+    }
+
+    fclose(file);
+}
+
+// Workload: load a generated file with load_data_from_file().
+static size_t bench_load_data_from_file(BenchmarkContext *context)
+{
+    char path[1024];
+    benchmark_path(context, path, sizeof(path), "benchmark_input.txt");
+    write_input_file(context, path);
+
+    IntegerLinkedList list;
+    create_list(&list);
+
+    timer_start(context);
+    linked_list_load_data_from_file(&list, path);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    remove(path);
+    return context->size;
+}
+
+// Workload: load a file of random values with the parallel loader, using
+// one thread per processor.
+static size_t bench_load_data_parallel(BenchmarkContext *context)
+{
+    char path[1024];
+    benchmark_path(context, path, sizeof(path), "benchmark_input.txt");
+    write_input_file(context, path);
+
+    IntegerLinkedList list;
+    LinkedListLoadReport report;
+    create_list(&list);
+
+    timer_start(context);
+    linked_list_load_data_parallel(&list, path, 0, &report);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    remove(path);
+    return context->size;
+}
+
+// Workload: search a file of random values for a value it does not contain
+// with a stream, without loading it into a list.
+static size_t bench_stream_find_miss(BenchmarkContext *context)
+{
+    char path[1024];
+    benchmark_path(context, path, sizeof(path), "benchmark_input.txt");
+    write_input_file(context, path);
+
+    IntegerStream stream;
+
+    timer_start(context);
+    if (integer_stream_open(&stream, path, 0))
+    {
+        integer_stream_find_first_index_containing(&stream, TARGET_VALUE);
+        integer_stream_close(&stream);
+    }
+    timer_stop(context);
+
+    remove(path);
+    return context->size;
+}
+
+// Workload: copy the odd values of a file of random values into a list with
+// a stream.
+static size_t bench_stream_filter_odd(BenchmarkContext *context)
+{
+    char path[1024];
+    benchmark_path(context, path, sizeof(path), "benchmark_input.txt");
+    write_input_file(context, path);
+
+    IntegerLinkedList list;
+    IntegerStream stream;
+    create_list(&list);
+
+    timer_start(context);
+    if (integer_stream_open(&stream, path, 0))
+    {
+        integer_stream_filter_into_list(&stream, &list, is_odd, NULL);
+        integer_stream_close(&stream);
+    }
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    remove(path);
+    return context->size;
+}
+
+// Workload: write a full list with output_to_file().
+static size_t bench_output_to_file(BenchmarkContext *context)
+{
+    char path[1024];
+    benchmark_path(context, path, sizeof(path), "benchmark_output.txt");
+
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    timer_start(context);
+    linked_list_output_to_file(&list, path);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    remove(path);
+    return context->size;
+}
+
+// Workload: write a full list in the binary format with save_binary().
+static size_t bench_save_binary(BenchmarkContext *context)
+{
+    char path[1024];
+    benchmark_path(context, path, sizeof(path), "benchmark_output.bin");
+
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+
+    timer_start(context);
+    linked_list_save_binary(&list, path);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    remove(path);
+    return context->size;
+}
+
+// Workload: load a file of random values in the binary format with
+// load_binary().
+static size_t bench_load_binary(BenchmarkContext *context)
+{
+    char path[1024];
+    benchmark_path(context, path, sizeof(path), "benchmark_input.bin");
+
+    IntegerLinkedList list;
+    create_filled_list(context, &list, context->size);
+    if (linked_list_save_binary(&list, path) != LINKED_LIST_BINARY_OK)
+    {
+        fprintf(stderr, "ERROR: Unable to create %s file.\n", path);
+        exit(EXIT_FAILURE);
+    }
+    linked_list_cleanup(&list);
+    create_list(&list);
+
+    timer_start(context);
+    linked_list_load_binary(&list, path);
+    timer_stop(context);
+
+    linked_list_cleanup(&list);
+    remove(path);
+    return context->size;
+}
+
+// Workload: append random values to a journaled list, writing the journal in
+// groups of the default size.
+static size_t bench_journaled_push_back(BenchmarkContext *context)
+{
+    char checkpointPath[1024];
+    char journalPath[1024];
+    benchmark_path(context, checkpointPath, sizeof(checkpointPath), "benchmark_checkpoint.bin");
+    benchmark_path(context, journalPath, sizeof(journalPath), "benchmark_journal.log");
+    remove(checkpointPath);
+    remove(journalPath);
+
+    JournaledIntegerList list;
+    if (journaled_list_open(&list, checkpointPath, journalPath, 0, 0) != LINKED_LIST_BINARY_OK)
+    {
+        fprintf(stderr, "ERROR: Unable to create %s file.\n", journalPath);
+        exit(EXIT_FAILURE);
+    }
+
+    timer_start(context);
+    for (size_t i = 0; i < context->size; ++i)
+    {
+        journaled_list_push_back(&list, random_value(context));
+    }
+    journaled_list_commit(&list);
+    timer_stop(context);
+
+    journaled_list_close(&list);
+    remove(checkpointPath);
+    remove(journalPath);
+    return context->size;
+}
+
+// Workload: restore a journaled list whose checkpoint holds half of its
+// values and whose journal holds the other half, to compare with loading the
+// same number of values from text.
+static size_t bench_journaled_restore(BenchmarkContext *context)
+{
+    char checkpointPath[1024];
+    char journalPath[1024];
+    benchmark_path(context, checkpointPath, sizeof(checkpointPath), "benchmark_checkpoint.bin");
+    benchmark_path(context, journalPath, sizeof(journalPath), "benchmark_journal.log");
+    remove(checkpointPath);
+    remove(journalPath);
+
+    JournaledIntegerList list;
+    if (journaled_list_open(&list, checkpointPath, journalPath, 0, 0) != LINKED_LIST_BINARY_OK)
+    {
+        fprintf(stderr, "ERROR: Unable to create %s file.\n", journalPath);
+        exit(EXIT_FAILURE);
+    }
+
+    for (size_t i = 0; i < context->size; ++i)
+    {
+        if (i == context->size / 2) { journaled_list_checkpoint(&list); }
+        journaled_list_push_back(&list, random_value(context));
+    }
+    journaled_list_close(&list);
+
+    timer_start(context);
+    journaled_list_open(&list, checkpointPath, journalPath, 0, 0);
+    timer_stop(context);
+
+    journaled_list_close(&list);
+    remove(checkpointPath);
+    remove(journalPath);
+    return context->size;
+}
+
+// Every workload of the benchmark, in the order they are run.
+static BenchmarkCase const BENCHMARKS[] = {
+    { "push_back", bench_push_back },
+    { "push_front", bench_push_front },
+    { "push_back_array", bench_push_back_array },
+    { "int64_push_back", bench_int64_push_back },
+    { "push_front_array", bench_push_front_array },
+    { "export_array", bench_export_array },
+    { "pop_back", bench_pop_back },
+    { "pop_front", bench_pop_front },
+    { "pop_front_push_back_churn", bench_pop_churn },
+    { "element_at_sequential", bench_element_at_sequential },
+    { "element_at_random", bench_element_at_random },
+    { "remove_at_index_random", bench_remove_at_index },
+    { "remove_value_miss", bench_remove_value_miss },
+    { "remove_value_1_percent", bench_remove_value_1_percent },
+    { "remove_value_50_percent", bench_remove_value_50_percent },
+    { "remove_values_16", bench_remove_values },
+    { "remove_if_odd", bench_remove_if },
+    { "find_first_index_miss", bench_find_miss },
+    { "contains_indexed", bench_contains_indexed },
+    { "iterate_forward", bench_iterate },
+    { "aggregates_poll", bench_aggregates_poll },
+    { "traversal_poll", bench_traversal_poll },
+    { "compact_push_back", bench_compact_push_back },
+    { "compact_iterate_forward", bench_compact_iterate },
+    { "compact_find_miss", bench_compact_find_miss },
+    { "parallel_sum", bench_parallel_sum },
+    { "parallel_find_first_miss", bench_parallel_find_miss },
+    { "persistent_push_back", bench_persistent_push_back },
+    { "persistent_snapshot_write", bench_persistent_snapshot_write },
+    { "deep_copy", bench_deep_copy },
+    { "concat_halves", bench_concat },
+    { "split_half", bench_split },
+    { "sort", bench_sort },
+    { "sort_by_copy_qsort", bench_sort_by_copy },
+    { "sorted_insert_random", bench_sorted_insert },
+    { "sorted_find_miss", bench_sorted_find_miss },
+    { "concurrent_queue_1_thread", bench_concurrent_queue_1 },
+    { "concurrent_queue_2_threads", bench_concurrent_queue_2 },
+    { "concurrent_queue_4_threads", bench_concurrent_queue_4 },
+    { "concurrent_queue_8_threads", bench_concurrent_queue_8 },
+    { "concurrent_queue_16_threads", bench_concurrent_queue_16 },
+    { "concurrent_queue_32_threads", bench_concurrent_queue_32 },
+    { "mutex_queue_1_thread", bench_mutex_queue_1 },
+    { "mutex_queue_2_threads", bench_mutex_queue_2 },
+    { "mutex_queue_4_threads", bench_mutex_queue_4 },
+    { "mutex_queue_8_threads", bench_mutex_queue_8 },
+    { "mutex_queue_16_threads", bench_mutex_queue_16 },
+    { "mutex_queue_32_threads", bench_mutex_queue_32 },
+    { "locked_list_mixed_1_thread", bench_locked_mixed_1 },
+    { "locked_list_mixed_2_threads", bench_locked_mixed_2 },
+    { "locked_list_mixed_4_threads", bench_locked_mixed_4 },
+    { "locked_list_mixed_8_threads", bench_locked_mixed_8 },
+    { "mutex_list_mixed_1_thread", bench_mutex_mixed_1 },
+    { "mutex_list_mixed_2_threads", bench_mutex_mixed_2 },
+    { "mutex_list_mixed_4_threads", bench_mutex_mixed_4 },
+    { "mutex_list_mixed_8_threads", bench_mutex_mixed_8 },
+    { "clear", bench_clear },
+    { "compact", bench_compact },
+    { "load_data_from_file", bench_load_data_from_file },
+    { "load_data_parallel", bench_load_data_parallel },
+    { "stream_find_first_miss", bench_stream_find_miss },
+    { "stream_filter_odd", bench_stream_filter_odd },
+    { "output_to_file", bench_output_to_file },
+    { "save_binary", bench_save_binary },
+    { "load_binary", bench_load_binary },
+    { "journaled_push_back", bench_journaled_push_back },
+    { "journaled_restore", bench_journaled_restore },
+};
+
+// Runs a workload `repeat` times and records its fastest repetition.
+static BenchmarkResult run_benchmark(BenchmarkContext *context, BenchmarkCase const *benchmark)
+{
+    BenchmarkResult result = { benchmark->name, 0, 0, 0 };
+
+    for (int i = 0; i < context->repeat; ++i)
+    {
+        context->elapsedNanoseconds = 0;
+        result.operations = benchmark->run(context);
+
+        if (i == 0 || context->elapsedNanoseconds < result.nanoseconds)
+        {
+            result.nanoseconds = context->elapsedNanoseconds;
+        }
+    }
+
+    result.peakResidentKilobytes = peak_resident_kilobytes();
+    return result;
+}
+
+// Returns the average nanoseconds per operation of a result.
+static double nanoseconds_per_operation(BenchmarkResult const *result)
+{
+    return result->operations ? (double)result->nanoseconds / (double)result->operations : 0.0;
+}
+
+// Returns the operations per second of a result.
+static double operations_per_second(BenchmarkResult const *result)
+{
+    return result->nanoseconds ? (double)result->operations * 1e9 / (double)result->nanoseconds : 0.0;
+}
+
+// Prints a result as a row of the human readable table.
+static void print_result(BenchmarkResult const *result)
+{
+    printf("%-28s %12zu %14.2f %16.0f %12zu\n", result->name, result->operations,
+           nanoseconds_per_operation(result), operations_per_second(result),
+           result->peakResidentKilobytes);
+}
+
+// Writes every result as a JSON document.
+static void write_json(FILE *file, BenchmarkContext const *context,
+                       BenchmarkResult const *results, size_t const count)
+{
+    fprintf(file, "{\n  \"size\": %zu,\n  \"repeat\": %d,\n  \"peak_rss_kb\": %zu,\n",
+            context->size, context->repeat, peak_resident_kilobytes());
+    fprintf(file, "  \"results\": [\n");
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        fprintf(file,
+                "    { \"name\": \"%s\", \"operations\": %zu, \"total_ns\": %llu, "
+                "\"ns_per_op\": %.3f, \"ops_per_second\": %.1f, \"peak_rss_kb\": %zu }%s\n",
+                results[i].name, results[i].operations, results[i].nanoseconds,
+                nanoseconds_per_operation(&results[i]), operations_per_second(&results[i]),
+                results[i].peakResidentKilobytes, i + 1 < count ? "," : "");
+    }
+
+    fprintf(file, "  ]\n}\n");
+}
+
+// Prints the command line options of the benchmark.
+static void print_usage(char const *program)
+{
+    printf("Usage: %s [--size N] [--repeat N] [--filter TEXT] [--dir PATH] [--json FILE]\n"
+           "\t--size N       Number of elements per workload (default %d).\n"
+           "\t--repeat N     Repetitions per workload, the fastest is reported (default %d).\n"
+           "\t--filter TEXT  Only run workloads whose name contains TEXT.\n"
+           "\t--dir PATH     Directory for the files of the I/O workloads (default .).\n"
+           "\t--json FILE    Also write the results as JSON, '-' for stdout.\n",
+           program, DEFAULT_SIZE, DEFAULT_REPEAT);
+}
+
+// Program entry point.
+int main(int argc, char **argv)
+{
+    BenchmarkContext context = { DEFAULT_SIZE, DEFAULT_REPEAT, ".", 0, 0, 0x853C49E6748FEA9BULL };
+    char const *jsonPath = NULL;
+    char const *filter = NULL;
+
+    // Read the command line options, every option takes a value.
+    for (int i = 1; i < argc; ++i)
+    {
+        bool const hasValue = i + 1 < argc;
+
+        if (strcmp(argv[i], "--size") == 0 && hasValue)
+        {
+            context.size = (size_t)strtoull(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--repeat") == 0 && hasValue)
+        {
+            context.repeat = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--filter") == 0 && hasValue)
+        {
+            filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "--dir") == 0 && hasValue)
+        {
+            context.directory = argv[++i];
+        }
+        else if (strcmp(argv[i], "--json") == 0 && hasValue)
+        {
+            jsonPath = argv[++i];
+        }
+        else
+        {
+            print_usage(argv[0]);
+            return strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    // Workloads need at least one element and one repetition.
+    if (context.size == 0 || context.repeat < 1)
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    // Run every selected workload, printing each result as it completes.
+    BenchmarkResult results[MAXIMUM_RESULTS];
+    size_t resultCount = 0;
+
+    printf("Linked list benchmark, %zu elements, best of %d.\n", context.size, context.repeat);
+    printf("%-28s %12s %14s %16s %12s\n", "workload", "operations", "ns/op", "ops/s", "peak RSS KB");
+
+    for (size_t i = 0; i < sizeof(BENCHMARKS) / sizeof(BENCHMARKS[0]); ++i)
+    {
+        if (filter && !strstr(BENCHMARKS[i].name, filter)) { continue; }
+
+        results[resultCount] = run_benchmark(&context, &BENCHMARKS[i]);
+        print_result(&results[resultCount]);
+        fflush(stdout);
+        ++resultCount;
+    }
+
+    // Write the machine readable results if requested.
+    if (jsonPath)
+    {
+        FILE *file = strcmp(jsonPath, "-") == 0 ? stdout : fopen(jsonPath, "w");
+        if (!file)
+        {
+            fprintf(stderr, "ERROR: Unable to open %s file.\n", jsonPath);
+            return 1;
+        }
+
+        write_json(file, &context, results, resultCount);
+        if (file != stdout) { fclose(file); }
+    }
+
+    return 0;
+}
@@ -28,6 +28,10 @@
 // successfully read from the input file in load_data_from_file().
 #define READ_SUCCESS 1
 
+// Defines a constant used to limit the number of elements printed to the
+// console, so that lists loaded from large files do not flood the terminal.
+#define DISPLAY_LIMIT 100
+
 // Issue platform dependent calls to clear the console.
 static void clear_screen(void )
 {
@@ -52,18 +56,25 @@ static void clear_screen(void )
 #endif
 }
 
+// Prints the size of the list and its contents, showing at most the first
+// DISPLAY_LIMIT elements.
+static void display_list(IntegerLinkedList *list)
+{
+    linked_list_print_list_page(list, 0, DISPLAY_LIMIT);
+}
+
 // Prints the size and contents of the list following a user requested operation.
 static void print_list_after(IntegerLinkedList *list)
 {
     printf("List after requested operation:\n");
-    linked_list_print_list(list);
+    display_list(list);
 }
 
 // Prints the size and contents of the list following a user requested operation.
 static void print_list_before(IntegerLinkedList *list)
 {
     printf("List before requested operation:\n");
-    linked_list_print_list(list);
+    display_list(list);
 }
 
 // Prints an informational message and returns true if the list is empty.
@@ -175,7 +186,7 @@ static size_t read_valid_index_from_console(IntegerLinkedList *list,
         if (choice >= list->size)
         {
             printf("That index it out of the bounds of the list and cannot be used.\n");
-            linked_list_print_list(list);
+            display_list(list);
             printf("Please enter a valid index: ");
         }
     }
@@ -254,7 +265,7 @@ static void pop_back(IntegerLinkedList *list)
 static void remove_at_index(IntegerLinkedList *list)
 {
     clear_screen();
-    linked_list_print_list(list);
+    display_list(list);
 
     // Retrieve an index from the user.
     size_t index = read_valid_index_from_console(list, 
@@ -269,7 +280,7 @@ static void remove_at_index(IntegerLinkedList *list)
 static void remove_number(IntegerLinkedList *list)
 {
     clear_screen();
-    linked_list_print_list(list);
+    display_list(list);
 
     // Retrieve a number from the user.
     int value = read_number_from_console("Enter the number you with to remove: ");
@@ -300,7 +311,7 @@ static void remove_number(IntegerLinkedList *list)
 static void print_list(IntegerLinkedList *list)
 {
     clear_screen();
-    linked_list_print_list(list);
+    display_list(list);
 }
 
 // Searches the list for a specified value, displays the index if found, displays
@@ -308,7 +319,7 @@ static void print_list(IntegerLinkedList *list)
 static void search_list(IntegerLinkedList *list)
 {
     clear_screen();
-    linked_list_print_list(list);
+    display_list(list);
 
     // Retrieve a value to search for from the user.
     int value = read_number_from_console("Enter the number you wish to find: ");
@@ -358,14 +369,14 @@ static void output_to_file(IntegerLinkedList *list)
 
     linked_list_output_to_file(list, buffer);
     printf("List contents written to '%s'\n", buffer);
-    linked_list_print_list(list);
+    display_list(list);
 }
 
 // Display the value at the beginning of the list.
 static void read_front(IntegerLinkedList *list)
 {
     clear_screen();
-    linked_list_print_list(list);
+    display_list(list);
     printf("Value at the beginning of the list: %d\n\n", linked_list_front(list));
 }
 
@@ -373,7 +384,7 @@ static void read_front(IntegerLinkedList *list)
 static void read_back(IntegerLinkedList *list)
 {
     clear_screen();
-    linked_list_print_list(list);
+    display_list(list);
     printf("Value at the end of the list: %d\n\n", linked_list_back(list));
 }
 
@@ -381,7 +392,7 @@ static void read_back(IntegerLinkedList *list)
 static void read_at_index(IntegerLinkedList *list)
 {
     clear_screen();
-    linked_list_print_list(list);
+    display_list(list);
 
     // Read a valid index from the user.
     size_t index = read_valid_index_from_console(list, 
@@ -0,0 +1,829 @@
+/*
+* File Name: compact_linked_list.c
+* Purpose: Contains constants and function definitions for the compact
+*          variant of my linked list implementation.
+*
+*          Every node lives in one array, the arena, and refers to its
+*          neighbours by their position in it.  A 32-bit index takes half
+*          the space of a pointer, so a node needs 12 bytes where an
+*          IntegerNode needs 24, twice as many nodes fit in each cache line,
+*          and the arena can be reallocated as it grows without updating a
+*          single link.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Include the header for the compact linked list.
+#include "compact_linked_list.h"
+
+// Include the private helpers used to read files.
+#include "file_mapping.h"
+#include "text_scanner.h"
+
+// Include the private formatter used to write lists.
+#include "output_buffer.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Defines a constant which will be used to check the string length of the
+// file name passed to load_data_from_file().
+#define MINIMUM_NAME_LENGTH 4
+
+// Defines a constant for the number of nodes the arena holds once it is
+// first allocated, small lists should not pay for a large arena.
+#define MINIMUM_ARENA_CAPACITY 32
+
+// Defines a constant for the number of values parsed from a file before they
+// are appended to the list together.
+#define LOAD_BATCH_SIZE 4096
+
+// Internal function that prints a diagnostic message and aborts the program if
+// a call to malloc returns a null pointer, or the arena runs out of indices.
+static void internal_bad_alloc(void)
+{
+    fprintf(stderr, "Memory allocation failed!\n");
+    abort();
+}
+
+// Internal function that prints a diagnostic message and aborts the program if
+// the user attempts to access an index which is outside the bounds of the list.
+static void internal_out_of_bounds(size_t const size, size_t const index)
+{
+    fprintf(stderr, "Attempt to access index out of range!\n");
+    fprintf(stderr, "Index %zu of list with size %zu.\n", index, size);
+    abort();
+}
+
+// Internal function that grows the arena until at least `count` nodes can be
+// handed out after the ones already used.  Doubling keeps appends amortized
+// constant time, and nodes keep their indices when the arena moves.
+static void internal_reserve(CompactIntegerList *list, size_t const count)
+{
+    size_t const required = (size_t)list->used + count;
+
+    if (required <= list->capacity) { return; }
+
+    // Index COMPACT_LIST_NONE is reserved to mark missing nodes.
+    if (required > COMPACT_LIST_NONE) { internal_bad_alloc(); }
+
+    size_t capacity = list->capacity ? list->capacity : MINIMUM_ARENA_CAPACITY;
+    while (capacity < required) { capacity *= 2; }
+    if (capacity > COMPACT_LIST_NONE) { capacity = COMPACT_LIST_NONE; }
+
+    CompactNode *nodes = realloc(list->nodes, capacity * sizeof(CompactNode));
+    if (!nodes) { internal_bad_alloc(); }
+
+    list->nodes = nodes;
+    list->capacity = (uint32_t)capacity;
+}
+
+// Internal function that returns the index of an unused node, reusing a
+// released node before handing out a new one.
+static uint32_t internal_acquire(CompactIntegerList *list)
+{
+    if (list->freeList != COMPACT_LIST_NONE)
+    {
+        uint32_t const index = list->freeList;
+        list->freeList = list->nodes[index].next;
+        return index;
+    }
+
+    internal_reserve(list, 1);
+    return list->used++;
+}
+
+// Internal function that returns a node to the list of released nodes.
+static void internal_release(CompactIntegerList *list, uint32_t const index)
+{
+    list->nodes[index].next = list->freeList;
+    list->freeList = index;
+}
+
+// Internal function that returns the index of the node at `index` in the
+// list, walking from whichever of the head, tail, or cursor is closest.
+static uint32_t internal_locate(CompactIntegerList const *list, size_t const index)
+{
+    // Start out assuming the head is closest.
+    uint32_t node = list->head;
+    size_t position = 0;
+    size_t distance = index;
+
+    // The tail may be closer.
+    if (list->size - 1 - index < distance)
+    {
+        node = list->tail;
+        position = list->size - 1;
+        distance = list->size - 1 - index;
+    }
+
+    // The cursor may be closer still.
+    if (list->cursor->node != COMPACT_LIST_NONE)
+    {
+        size_t const cursorDistance = index > list->cursor->index
+                                    ? index - list->cursor->index
+                                    : list->cursor->index - index;
+        if (cursorDistance < distance)
+        {
+            node = list->cursor->node;
+            position = list->cursor->index;
+        }
+    }
+
+    // Walk forward or backward from the chosen starting point.
+    while (position < index)
+    {
+        node = list->nodes[node].next;
+        ++position;
+    }
+    while (position > index)
+    {
+        node = list->nodes[node].previous;
+        --position;
+    }
+
+    return node;
+}
+
+// Internal function that unlinks the node at position `index` from the list,
+// keeping the cursor on a valid node, and releases it.
+static void internal_remove_node(CompactIntegerList *list, uint32_t const node,
+                                 size_t const index)
+{
+    CompactNode const removed = list->nodes[node];
+
+    // If the cursor is on the removed node, move it to the node which takes
+    // its index, or to the previous node when the last node is removed.  If
+    // the cursor is after the removed node, its index shifts down by one.
+    if (list->cursor->node == node)
+    {
+        if (removed.next != COMPACT_LIST_NONE)
+        {
+            list->cursor->node = removed.next;
+        }
+        else
+        {
+            list->cursor->node = removed.previous;
+            --list->cursor->index;
+        }
+    }
+    else if (list->cursor->node != COMPACT_LIST_NONE && list->cursor->index > index)
+    {
+        --list->cursor->index;
+    }
+
+    // Join the neighbours of the node, or move the ends of the list.
+    if (removed.previous != COMPACT_LIST_NONE)
+    {
+        list->nodes[removed.previous].next = removed.next;
+    }
+    else
+    {
+        list->head = removed.next;
+    }
+
+    if (removed.next != COMPACT_LIST_NONE)
+    {
+        list->nodes[removed.next].previous = removed.previous;
+    }
+    else
+    {
+        list->tail = removed.previous;
+    }
+
+    internal_release(list, node);
+    --list->size;
+}
+
+// Internal function that removes every node whose value satisfies the
+// predicate in a single pass over the list.  Returns the number of nodes
+// removed.
+static size_t internal_remove_matching(CompactIntegerList *list,
+                                       LinkedListPredicate const predicate, void *context)
+{
+    size_t const originalSize = list->size;
+    uint32_t node = list->head;
+    size_t index = 0;
+
+    while (node != COMPACT_LIST_NONE)
+    {
+        uint32_t const next = list->nodes[node].next;
+
+        if (predicate(list->nodes[node].data, context))
+        {
+            internal_remove_node(list, node, index);
+        }
+        else
+        {
+            ++index;
+        }
+
+        node = next;
+    }
+
+    return originalSize - list->size;
+}
+
+// Internal predicate that matches one value, passed through `context`.
+static bool internal_equals(int const value, void *context)
+{
+    return value == *(int const *)context;
+}
+
+// Internal function that links `count` new nodes holding `values` together in
+// a run of consecutive arena indices.  Returns the index of the first node.
+static uint32_t internal_allocate_run(CompactIntegerList *list, int const *values,
+                                      size_t const count)
+{
+    internal_reserve(list, count);
+
+    uint32_t const first = list->used;
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t const index = first + (uint32_t)i;
+        list->nodes[index].data = values[i];
+        list->nodes[index].previous = i > 0 ? index - 1 : COMPACT_LIST_NONE;
+        list->nodes[index].next = i + 1 < count ? index + 1 : COMPACT_LIST_NONE;
+    }
+
+    list->used += (uint32_t)count;
+    return first;
+}
+
+// Internal function that writes the size of the list and at most `count`
+// elements starting at index `first` to the stream, in the format of
+// linked_list_print_list().  Returns false if the output could not be
+// written completely.
+static bool internal_write_list(CompactIntegerList const *list, FILE *stream,
+                                size_t const first, size_t count)
+{
+    // Prepare the buffer, aborting the program if allocation fails.
+    OutputBuffer buffer;
+    if (!output_buffer_open(&buffer, stream)) { internal_bad_alloc(); }
+
+    // Limit the range to the elements which actually exist.
+    size_t const start = first < list->size ? first : list->size;
+    if (count > list->size - start) { count = list->size - start; }
+
+    // Write the number of elements, then mark any elements left out before
+    // the range, counting the mark as an element so a comma follows it.
+    output_buffer_begin_list(&buffer, list->size);
+    if (start > 0)
+    {
+        output_buffer_append_text(&buffer, " ...");
+        buffer.elementCount = 1;
+    }
+
+    // Write the elements of the range.
+    uint32_t node = start < list->size ? internal_locate(list, start) : COMPACT_LIST_NONE;
+    for (size_t written = 0; written < count; ++written)
+    {
+        output_buffer_append_element(&buffer, list->nodes[node].data);
+        node = list->nodes[node].next;
+    }
+
+    // Mark any elements left out after the range, then close the list.
+    if (start + count < list->size)
+    {
+        output_buffer_append_text(&buffer, buffer.elementCount > 0 ? ", ..." : " ...");
+    }
+    output_buffer_end_list(&buffer);
+
+    return output_buffer_close(&buffer);
+}
+
+// Internal function that empties the list and leaves it without an arena,
+// which the caller must already have freed.
+static void internal_reset(CompactIntegerList *list)
+{
+    list->nodes = NULL;
+    list->capacity = 0;
+    list->used = 0;
+    list->freeList = COMPACT_LIST_NONE;
+    list->head = COMPACT_LIST_NONE;
+    list->tail = COMPACT_LIST_NONE;
+    list->size = 0;
+    list->cursor->node = COMPACT_LIST_NONE;
+    list->cursor->index = 0;
+}
+
+// Initialize the list handle.  The arena is only allocated once the first
+// node is added, so only the cursor is allocated here.  The cursor is kept
+// apart from the handle so that compact_list_element_at() can move it through
+// a const handle.  Returns false if that allocation fails.
+bool compact_list_initialize(CompactIntegerList *list)
+{
+    list->cursor = malloc(sizeof(CompactListCursor));
+    if (!list->cursor) { return false; }
+
+    internal_reset(list);
+    return true;
+}
+
+// Initialize the list handle and populate with values from a file.  Any
+// problem with the file is reported as a diagnostic message, use
+// compact_list_load_data_with_report() to handle problems programmatically.
+void compact_list_load_data_from_file(CompactIntegerList *list, char const *fileName)
+{
+    // Ensure a file name is provided, and that it contains enough characters
+    // for the file extension plus at least one character for the file name.
+    if (!fileName || strlen(fileName) < MINIMUM_NAME_LENGTH)
+    {
+        fprintf(stderr, "ERROR: Please provide the name of a text (.txt) file.\n");
+        return;
+    }
+
+    // Load the values, keeping the report to describe any problem.
+    LinkedListLoadReport report;
+    if (compact_list_load_data_with_report(list, fileName, &report)) { return; }
+
+    // If reading stopped at invalid text, point the user at it.
+    if (report.parseError)
+    {
+        fprintf(stderr, "ERROR: Invalid integer at line %zu, column %zu of %s, "
+                        "%zu values were read.\n",
+                report.errorLine, report.errorColumn, fileName, report.valuesRead);
+        return;
+    }
+
+    // Otherwise the file could not be opened.
+    fprintf(stderr, "ERROR: Unable to open %s file.\n", fileName);
+}
+
+// Appends the whitespace separated integers stored in a file to the list,
+// exactly as linked_list_load_data_with_report() does.  Returns true if the
+// whole file was read.
+bool compact_list_load_data_with_report(CompactIntegerList *list, char const *fileName,
+                                        LinkedListLoadReport *report)
+{
+    // Start from an empty report.
+    report->valuesRead = 0;
+    report->parseError = false;
+    report->errorOffset = 0;
+    report->errorLine = 0;
+    report->errorColumn = 0;
+
+    // Map the file into memory, reporting failure if that is not possible.
+    MappedFile mapping;
+    if (!fileName || !file_mapping_open(&mapping, fileName)) { return false; }
+
+    // Scan the mapped text, appending the values a batch at a time.
+    TextScanner scanner;
+    text_scanner_initialize(&scanner, mapping.data, mapping.length);
+
+    int batch[LOAD_BATCH_SIZE];
+    size_t batchCount = 0;
+    TextScanStatus status;
+
+    while ((status = text_scanner_next(&scanner, &batch[batchCount])) == TEXT_SCAN_VALUE)
+    {
+        if (++batchCount == LOAD_BATCH_SIZE)
+        {
+            compact_list_push_back_array(list, batch, batchCount);
+            report->valuesRead += batchCount;
+            batchCount = 0;
+        }
+    }
+
+    compact_list_push_back_array(list, batch, batchCount);
+    report->valuesRead += batchCount;
+
+    // Record where the text stopped being valid, if it did.
+    if (status == TEXT_SCAN_ERROR)
+    {
+        report->parseError = true;
+        report->errorOffset = scanner.errorOffset;
+        report->errorLine = scanner.errorLine;
+        report->errorColumn = scanner.errorColumn;
+    }
+
+    file_mapping_close(&mapping);
+    return !report->parseError;
+}
+
+// Cleanup function that frees the arena, and with it every node, then the
+// cursor.  The list must be initialized again before reuse.
+void compact_list_cleanup(CompactIntegerList *list)
+{
+    free(list->nodes);
+    internal_reset(list);
+    free(list->cursor);
+    list->cursor = NULL;
+}
+
+// Returns unused memory to the system.  The arena shrinks to the nodes handed
+// out so far, or is freed entirely when the list is empty.  Released nodes
+// between used ones are kept, compact_list_compact() removes them as well.
+void compact_list_trim(CompactIntegerList *list)
+{
+    if (list->size == 0)
+    {
+        free(list->nodes);
+        internal_reset(list);
+        return;
+    }
+
+    if (list->used == list->capacity) { return; }
+
+    CompactNode *nodes = realloc(list->nodes, list->used * sizeof(CompactNode));
+    if (!nodes) { return; }
+
+    list->nodes = nodes;
+    list->capacity = list->used;
+}
+
+// Moves every node into a new arena that holds exactly the list, in list
+// order, so that traversals visit memory sequentially and no released nodes
+// take up space.
+void compact_list_compact(CompactIntegerList *list)
+{
+    if (list->size == 0)
+    {
+        free(list->nodes);
+        internal_reset(list);
+        return;
+    }
+
+    CompactNode *nodes = malloc(list->size * sizeof(CompactNode));
+    if (!nodes) { internal_bad_alloc(); }
+
+    // Copy the values in list order, linking each node to its neighbours.
+    uint32_t const last = (uint32_t)(list->size - 1);
+    uint32_t index = 0;
+    for (uint32_t node = list->head; node != COMPACT_LIST_NONE; node = list->nodes[node].next)
+    {
+        nodes[index].data = list->nodes[node].data;
+        nodes[index].previous = index > 0 ? index - 1 : COMPACT_LIST_NONE;
+        nodes[index].next = index < last ? index + 1 : COMPACT_LIST_NONE;
+        ++index;
+    }
+
+    free(list->nodes);
+    list->nodes = nodes;
+    list->capacity = (uint32_t)list->size;
+    list->used = (uint32_t)list->size;
+    list->freeList = COMPACT_LIST_NONE;
+    list->head = 0;
+    list->tail = last;
+
+    // The cursor keeps its position, which is now its index in the arena.
+    if (list->cursor->node != COMPACT_LIST_NONE)
+    {
+        list->cursor->node = (uint32_t)list->cursor->index;
+    }
+}
+
+// Clears the list, keeping the arena for the nodes added next.
+void compact_list_clear(CompactIntegerList *list)
+{
+    list->used = 0;
+    list->freeList = COMPACT_LIST_NONE;
+    list->head = COMPACT_LIST_NONE;
+    list->tail = COMPACT_LIST_NONE;
+    list->size = 0;
+    list->cursor->node = COMPACT_LIST_NONE;
+    list->cursor->index = 0;
+}
+
+// Adds a node with the specified value to the back of the list.
+void compact_list_push_back(CompactIntegerList *list, int const value)
+{
+    uint32_t const index = internal_acquire(list);
+    CompactNode *node = &list->nodes[index];
+
+    node->data = value;
+    node->next = COMPACT_LIST_NONE;
+    node->previous = list->tail;
+
+    if (list->tail != COMPACT_LIST_NONE)
+    {
+        list->nodes[list->tail].next = index;
+    }
+    else
+    {
+        list->head = index;
+    }
+
+    list->tail = index;
+    ++list->size;
+}
+
+// Adds a node with the specified value to the front of the list.
+void compact_list_push_front(CompactIntegerList *list, int const value)
+{
+    uint32_t const index = internal_acquire(list);
+    CompactNode *node = &list->nodes[index];
+
+    node->data = value;
+    node->previous = COMPACT_LIST_NONE;
+    node->next = list->head;
+
+    if (list->head != COMPACT_LIST_NONE)
+    {
+        list->nodes[list->head].previous = index;
+    }
+    else
+    {
+        list->tail = index;
+    }
+
+    list->head = index;
+    ++list->size;
+
+    // Every existing node moved back by one.
+    if (list->cursor->node != COMPACT_LIST_NONE) { ++list->cursor->index; }
+}
+
+// Appends the `count` values of an array to the back of the list, in array
+// order, as nodes with consecutive arena indices.
+void compact_list_push_back_array(CompactIntegerList *list, int const *values,
+                                  size_t const count)
+{
+    if (count == 0) { return; }
+
+    uint32_t const first = internal_allocate_run(list, values, count);
+    uint32_t const last = first + (uint32_t)(count - 1);
+
+    list->nodes[first].previous = list->tail;
+
+    if (list->tail != COMPACT_LIST_NONE)
+    {
+        list->nodes[list->tail].next = first;
+    }
+    else
+    {
+        list->head = first;
+    }
+
+    list->tail = last;
+    list->size += count;
+}
+
+// Prepends the `count` values of an array to the front of the list, keeping
+// their array order, as nodes with consecutive arena indices.
+void compact_list_push_front_array(CompactIntegerList *list, int const *values,
+                                   size_t const count)
+{
+    if (count == 0) { return; }
+
+    uint32_t const first = internal_allocate_run(list, values, count);
+    uint32_t const last = first + (uint32_t)(count - 1);
+
+    list->nodes[last].next = list->head;
+
+    if (list->head != COMPACT_LIST_NONE)
+    {
+        list->nodes[list->head].previous = last;
+    }
+    else
+    {
+        list->tail = last;
+    }
+
+    list->head = first;
+    list->size += count;
+
+    // Every existing node moved back by the number of new nodes.
+    if (list->cursor->node != COMPACT_LIST_NONE) { list->cursor->index += count; }
+}
+
+// Removes the last node in the list.
+void compact_list_pop_back(CompactIntegerList *list)
+{
+    if (list->size == 0) { return; }
+
+    internal_remove_node(list, list->tail, list->size - 1);
+}
+
+// Removes the first node in the list.
+void compact_list_pop_front(CompactIntegerList *list)
+{
+    if (list->size == 0) { return; }
+
+    internal_remove_node(list, list->head, 0);
+}
+
+// Removes a node at the specified index.
+void compact_list_remove_at_index(CompactIntegerList *list, size_t const index)
+{
+    // If the index passed as an argument is greater than the number of
+    // elements in the list, print a diagnostic message and abort.
+    if (index >= list->size) { internal_out_of_bounds(list->size, index); }
+
+    internal_remove_node(list, internal_locate(list, index), index);
+}
+
+// Removes all nodes from the list that contain the specified value.
+void compact_list_remove_value(CompactIntegerList *list, int const value)
+{
+    internal_remove_matching(list, internal_equals, (void *)&value);
+}
+
+// Removes every node whose value satisfies the predicate in a single pass.
+// Returns the number of nodes removed.
+size_t compact_list_remove_if(CompactIntegerList *list, LinkedListPredicate const predicate,
+                              void *context)
+{
+    return internal_remove_matching(list, predicate, context);
+}
+
+// Internal comparison of two integers for qsort().
+static int internal_compare(void const *left, void const *right)
+{
+    int const a = *(int const *)left;
+    int const b = *(int const *)right;
+    return (a > b) - (a < b);
+}
+
+// Sorts the elements of the list in ascending order.  Equal integers cannot
+// be told apart, so rather than relinking nodes the values are copied out,
+// sorted, and written back into the nodes in list order, leaving every link
+// and the cursor in place.
+void compact_list_sort(CompactIntegerList *list)
+{
+    if (list->size < 2) { return; }
+
+    int *values = malloc(list->size * sizeof(int));
+    if (!values) { internal_bad_alloc(); }
+
+    compact_list_export_array(list, values, list->size);
+    qsort(values, list->size, sizeof(int), internal_compare);
+
+    size_t index = 0;
+    for (uint32_t node = list->head; node != COMPACT_LIST_NONE; node = list->nodes[node].next)
+    {
+        list->nodes[node].data = values[index++];
+    }
+
+    free(values);
+}
+
+// Returns the value stored at the end of the list, aborting if it is empty.
+int compact_list_back(CompactIntegerList const *list)
+{
+    if (list->size == 0) { internal_out_of_bounds(0, 0); }
+
+    return list->nodes[list->tail].data;
+}
+
+// Returns the value stored at the beginning of the list, aborting if it is
+// empty.
+int compact_list_front(CompactIntegerList const *list)
+{
+    if (list->size == 0) { internal_out_of_bounds(0, 0); }
+
+    return list->nodes[list->head].data;
+}
+
+// Returns the value stored at the specified index, walking from whichever of
+// the head, tail, or cursor is closest, then leaving the cursor on it.  Moving
+// the cursor writes to the list, so threads reading the same list at once
+// must use compact_list_iterator_at() instead, which never changes the list.
+int compact_list_element_at(CompactIntegerList const *list, size_t const index)
+{
+    // If the index passed as an argument is greater than the number of
+    // elements in the list, print a diagnostic message and abort.
+    if (index >= list->size) { internal_out_of_bounds(list->size, index); }
+
+    // The cursor lives apart from the handle, so a const handle can move it.
+    list->cursor->node = internal_locate(list, index);
+    list->cursor->index = index;
+
+    return list->nodes[list->cursor->node].data;
+}
+
+// Copies up to `capacity` elements, in list order, into `values`.  Returns the
+// number of elements copied.
+size_t compact_list_export_array(CompactIntegerList const *list, int *values,
+                                 size_t const capacity)
+{
+    size_t count = 0;
+
+    for (uint32_t node = list->head; node != COMPACT_LIST_NONE && count < capacity;
+         node = list->nodes[node].next)
+    {
+        values[count++] = list->nodes[node].data;
+    }
+
+    return count;
+}
+
+// Returns an iterator positioned on the first node of the list.
+CompactListIterator compact_list_iterator_first(CompactIntegerList const *list)
+{
+    CompactListIterator iterator = { list, list->head, 0 };
+    return iterator;
+}
+
+// Returns an iterator positioned on the last node of the list, for scanning
+// the list backward.
+CompactListIterator compact_list_iterator_last(CompactIntegerList const *list)
+{
+    CompactListIterator iterator = { list, list->tail, list->size - 1 };
+    return iterator;
+}
+
+// Returns an iterator positioned on the node at the specified index, found
+// from whichever of the head, tail, or cursor is closest.
+CompactListIterator compact_list_iterator_at(CompactIntegerList const *list, size_t const index)
+{
+    if (index >= list->size) { internal_out_of_bounds(list->size, index); }
+
+    CompactListIterator iterator = { list, internal_locate(list, index), index };
+    return iterator;
+}
+
+// Returns true while the iterator is positioned on a node of the list.
+bool compact_list_iterator_valid(CompactListIterator const *iterator)
+{
+    return iterator->node != COMPACT_LIST_NONE;
+}
+
+// Returns the value stored by the node the iterator is positioned on.
+int compact_list_iterator_value(CompactListIterator const *iterator)
+{
+    return iterator->list->nodes[iterator->node].data;
+}
+
+// Moves the iterator to the following node.
+void compact_list_iterator_next(CompactListIterator *iterator)
+{
+    iterator->node = iterator->list->nodes[iterator->node].next;
+    ++iterator->index;
+}
+
+// Moves the iterator to the preceding node.
+void compact_list_iterator_previous(CompactListIterator *iterator)
+{
+    iterator->node = iterator->list->nodes[iterator->node].previous;
+    --iterator->index;
+}
+
+// Writes the list to a file in the format of linked_list_output_to_file().
+void compact_list_output_to_file(CompactIntegerList const *list, char const *fileName)
+{
+    // Ensure a file name is provided, and that it contains enough characters
+    // for the file extension plus at least one character for the file name.
+    if (!fileName || strlen(fileName) < MINIMUM_NAME_LENGTH)
+    {
+        fprintf(stderr, "ERROR: Please provide the name of a text (.txt) file.\n");
+        return;
+    }
+
+    FILE *file = fopen(fileName, "w");
+
+    if (!file)
+    {
+        fprintf(stderr, "ERROR: Unable to open %s file.\n", fileName);
+        return;
+    }
+
+    if (!internal_write_list(list, file, 0, list->size))
+    {
+        fprintf(stderr, "ERROR: Unable to write %s file.\n", fileName);
+    }
+
+    fclose(file);
+}
+
+// Returns the index of the first node that contains the desired value if the
+// value exists in the list, otherwise the size of the list is returned.
+size_t compact_list_find_first_index_containing(CompactIntegerList const *list, int const value)
+{
+    size_t index = 0;
+
+    for (uint32_t node = list->head; node != COMPACT_LIST_NONE; node = list->nodes[node].next)
+    {
+        if (list->nodes[node].data == value) { return index; }
+        ++index;
+    }
+
+    return index;
+}
+
+// Returns true if the list contains the specified value.
+bool compact_list_contains(CompactIntegerList const *list, int const value)
+{
+    return compact_list_find_first_index_containing(list, value) != list->size;
+}
+
+// Print the size of the list and every element to stdout.
+void compact_list_print_list(CompactIntegerList const *list)
+{
+    internal_write_list(list, stdout, 0, list->size);
+}
+
+// Print the size of the list and at most `count` elements starting at index
+// `first` to stdout.  Elements left out before or after the page are marked
+// with an ellipsis.
+void compact_list_print_list_page(CompactIntegerList const *list, size_t const first,
+                                  size_t const count)
+{
+    internal_write_list(list, stdout, first, count);
+}
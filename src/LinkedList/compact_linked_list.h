@@ -0,0 +1,152 @@
+/*
+* File Name: compact_linked_list.h
+* Purpose: Contains the public types and function declarations for the compact
+*          variant of my linked list implementation, whose nodes are stored
+*          in a single growable arena and link to each other with 32-bit
+*          indices instead of pointers.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_COMPACT_LINKED_LIST_H
+#define BACHURSKI_COMPACT_LINKED_LIST_H
+
+// Include the linked list header for the load report and predicate types.
+#include "linked_list.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Defines the index that marks a missing node, the arena can therefore hold
+// up to one node less than 2^32.
+#define COMPACT_LIST_NONE UINT32_MAX
+
+// Definition for a compact list node, 12 bytes instead of the 24 bytes of an
+// IntegerNode on 64-bit platforms.
+// Contains:
+// - Arena index of the `next` node.
+// - Arena index of the `previous` node.
+// - Integer value being stored.
+typedef struct CompactNode
+{
+    uint32_t next;
+    uint32_t previous;
+    int data;
+} CompactNode;
+
+// Position of the most recently accessed node, allocated apart from the list
+// handle so that element access through a const handle can move it.
+// Contains:
+// - Arena index of the node, or COMPACT_LIST_NONE.
+// - Position in the list of the node.
+typedef struct CompactListCursor
+{
+    uint32_t node;
+    size_t index;
+} CompactListCursor;
+
+// Compact Linked List Handle
+// Contains:
+// - Pointer to the arena every node of the list is stored in.
+// - Number of nodes the arena can hold.
+// - Number of arena nodes handed out so far, free or not.
+// - Index of the first released node, which link through `next`.
+// - Index of the beginning of the list.
+// - Index of the end of the list.
+// - Number of elements in the list.
+// - Pointer to the cursor, the most recently accessed node.
+typedef struct CompactIntegerList
+{
+    CompactNode *nodes;
+    uint32_t capacity;
+    uint32_t used;
+    uint32_t freeList;
+    uint32_t head;
+    uint32_t tail;
+    size_t size;
+    CompactListCursor *cursor;
+} CompactIntegerList;
+
+// Compact List Iterator
+// Contains:
+// - Pointer to the list being iterated.
+// - Index of the current node, COMPACT_LIST_NONE once iteration has left
+//   the list.
+// - Position in the list of the current node.
+typedef struct CompactListIterator
+{
+    CompactIntegerList const *list;
+    uint32_t node;
+    size_t index;
+} CompactListIterator;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying compact_linked_list.c
+    * file.  Comments only serve to separate declarations by their general
+    * purpose.
+*/
+
+// Initialization
+bool compact_list_initialize(CompactIntegerList *list);
+void compact_list_load_data_from_file(CompactIntegerList *list, char const *fileName);
+bool compact_list_load_data_with_report(CompactIntegerList *list, char const *fileName,
+                                        LinkedListLoadReport *report);
+
+// Cleanup
+void compact_list_cleanup(CompactIntegerList *list);
+void compact_list_trim(CompactIntegerList *list);
+void compact_list_compact(CompactIntegerList *list);
+
+// Modifiers
+void compact_list_clear(CompactIntegerList *list);
+void compact_list_push_back(CompactIntegerList *list, int const value);
+void compact_list_push_front(CompactIntegerList *list, int const value);
+void compact_list_push_back_array(CompactIntegerList *list, int const *values,
+                                  size_t const count);
+void compact_list_push_front_array(CompactIntegerList *list, int const *values,
+                                   size_t const count);
+void compact_list_pop_back(CompactIntegerList *list);
+void compact_list_pop_front(CompactIntegerList *list);
+void compact_list_remove_at_index(CompactIntegerList *list, size_t const index);
+void compact_list_remove_value(CompactIntegerList *list, int const value);
+size_t compact_list_remove_if(CompactIntegerList *list, LinkedListPredicate const predicate,
+                              void *context);
+
+// Ordering
+void compact_list_sort(CompactIntegerList *list);
+
+// Element Access
+int compact_list_back(CompactIntegerList const *list);
+int compact_list_front(CompactIntegerList const *list);
+int compact_list_element_at(CompactIntegerList const *list, size_t const index);
+size_t compact_list_export_array(CompactIntegerList const *list, int *values,
+                                 size_t const capacity);
+
+// Iteration
+CompactListIterator compact_list_iterator_first(CompactIntegerList const *list);
+CompactListIterator compact_list_iterator_last(CompactIntegerList const *list);
+CompactListIterator compact_list_iterator_at(CompactIntegerList const *list, size_t const index);
+bool compact_list_iterator_valid(CompactListIterator const *iterator);
+int compact_list_iterator_value(CompactListIterator const *iterator);
+void compact_list_iterator_next(CompactListIterator *iterator);
+void compact_list_iterator_previous(CompactListIterator *iterator);
+
+// Output
+void compact_list_output_to_file(CompactIntegerList const *list, char const *fileName);
+
+// Search
+size_t compact_list_find_first_index_containing(CompactIntegerList const *list, int const value);
+bool compact_list_contains(CompactIntegerList const *list, int const value);
+
+// Display
+void compact_list_print_list(CompactIntegerList const *list);
+void compact_list_print_list_page(CompactIntegerList const *list, size_t const first,
+                                  size_t const count);
+
+// End of header guard.
+#endif
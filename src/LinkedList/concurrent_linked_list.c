@@ -0,0 +1,655 @@
+/*
+* File Name: concurrent_linked_list.c
+* Purpose: Contains constants and function definitions for the lock-free deque
+*          variant of my linked list implementation.
+*
+*          The deque follows Maged Michael's CAS-based algorithm for shared
+*          deques: a single atomic anchor holds the front index, the back
+*          index and a status.  A push swings the anchor to the new node and
+*          marks it unstable, after which any thread finishes linking the old
+*          end node to the new one and marks the anchor stable again.  A pop
+*          only swings the anchor inward, so every operation completes with
+*          one successful compare and swap on the anchor, and a thread that
+*          finds the anchor unstable helps instead of waiting.
+*
+*          Popped nodes are only reused once no thread has them published as
+*          a hazard, so a thread never reads a node that has been handed out
+*          again.  The ends of the anchor may still be popped and pushed
+*          again while a thread works from a copy of it, so the anchor also
+*          holds a counter that changes on every update, and a stale copy
+*          only matches the anchor after the counter has wrapped around with
+*          the same nodes at both ends.  A thread finishing a push protects
+*          the node it replaces in a link as well, so the link cannot be
+*          handed out and pushed again before the exchange.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Include the header for the concurrent list.
+#include "concurrent_linked_list.h"
+
+// Include the header for yielding while other threads finish with nodes.
+#include "platform_thread.h"
+
+// Include required stdlib headers.
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Defines constants for the number of bits of a node index that select the
+// node inside its segment, and the number of nodes in a segment.
+#define SEGMENT_BITS 12
+#define SEGMENT_NODES ((uint32_t)1 << SEGMENT_BITS)
+
+// Defines constants for the number of bits a node index may use within the
+// anchor, and the mask that extracts one.
+#define INDEX_BITS 24
+#define INDEX_MASK (((uint32_t)1 << INDEX_BITS) - 1)
+
+// Defines constants for the position and width of the status within the
+// anchor, and the position of the counter which fills the bits above it.
+#define STATUS_SHIFT (2 * INDEX_BITS)
+#define STATUS_MASK 3
+#define COUNTER_SHIFT (STATUS_SHIFT + 2)
+
+// Defines a constant for the number of segments needed to hold every index.
+#define SEGMENT_COUNT (((size_t)INDEX_MASK + 1) >> SEGMENT_BITS)
+
+// Defines a constant for the number of popped nodes a handle collects before
+// checking which of them may be reused.  Twice the number of hazards that can
+// exist, so that at least half of them are freed by every check.
+#define RETIRE_THRESHOLD (2 * CONCURRENT_LIST_MAXIMUM_HANDLES * CONCURRENT_LIST_HAZARDS_PER_HANDLE)
+
+// Status of the anchor, either stable, or waiting for the node behind a newly
+// pushed back or front node to be linked to it.
+typedef enum AnchorStatus
+{
+    ANCHOR_STABLE,
+    ANCHOR_PUSHED_BACK,
+    ANCHOR_PUSHED_FRONT
+} AnchorStatus;
+
+// Internal function that prints a diagnostic message and aborts the program if
+// a call to malloc returns a null pointer, or the list runs out of indices.
+static void internal_bad_alloc(void)
+{
+    fprintf(stderr, "Memory allocation failed!\n");
+    abort();
+}
+
+// Internal functions that pack and unpack the front index, back index and
+// status held by an anchor.  The counter of the new anchor is one more than
+// the counter of `previous`, the anchor it replaces, wrapping around once it
+// no longer fits.
+static uint64_t internal_make_anchor(uint64_t const previous, uint32_t const front,
+                                     uint32_t const back, AnchorStatus const status)
+{
+    uint64_t const counter = (previous >> COUNTER_SHIFT) + 1;
+
+    return (uint64_t)front | ((uint64_t)back << INDEX_BITS)
+           | ((uint64_t)status << STATUS_SHIFT) | (counter << COUNTER_SHIFT);
+}
+
+static uint32_t internal_anchor_front(uint64_t const anchor)
+{
+    return (uint32_t)(anchor & INDEX_MASK);
+}
+
+static uint32_t internal_anchor_back(uint64_t const anchor)
+{
+    return (uint32_t)((anchor >> INDEX_BITS) & INDEX_MASK);
+}
+
+static AnchorStatus internal_anchor_status(uint64_t const anchor)
+{
+    return (AnchorStatus)((anchor >> STATUS_SHIFT) & STATUS_MASK);
+}
+
+// Internal function that returns the node stored at `index`, whose segment
+// must already be allocated.
+static ConcurrentNode *internal_node(ConcurrentIntegerList const *list, uint32_t const index)
+{
+    ConcurrentNode *segment = atomic_load(&list->segments[index >> SEGMENT_BITS]);
+    return &segment[index & (SEGMENT_NODES - 1)];
+}
+
+// Internal function that takes a node from the free list, or a never used
+// node when the free list is empty.  Aborts if the list runs out of indices
+// or memory.
+static uint32_t internal_allocate(ConcurrentIntegerList *list)
+{
+    // Take the first free node.  The counter in the upper half of the free
+    // list head changes on every update, so a head that was popped and pushed
+    // again in the meantime fails the exchange.
+    uint64_t head = atomic_load(&list->freeList);
+
+    while ((uint32_t)head != 0)
+    {
+        uint32_t const index = (uint32_t)head;
+        uint32_t const next = atomic_load(&internal_node(list, index)->nextFree);
+        uint64_t const replacement = ((head >> 32) + 1) << 32 | next;
+
+        if (atomic_compare_exchange_weak(&list->freeList, &head, replacement))
+        {
+            return index;
+        }
+    }
+
+    // Index zero marks a missing neighbour, so indices start from one.
+    uint32_t const index = atomic_fetch_add(&list->nextIndex, 1);
+
+    if (index > INDEX_MASK) { internal_bad_alloc(); }
+
+    // Allocate the segment holding the index if no thread has done so yet.
+    _Atomic(ConcurrentNode *) *slot = &list->segments[index >> SEGMENT_BITS];
+
+    if (!atomic_load(slot))
+    {
+        ConcurrentNode *segment = calloc(SEGMENT_NODES, sizeof(ConcurrentNode));
+        ConcurrentNode *expected = NULL;
+
+        if (!segment) { internal_bad_alloc(); }
+
+        // Another thread may have installed the segment first.
+        if (!atomic_compare_exchange_strong(slot, &expected, segment))
+        {
+            free(segment);
+        }
+    }
+
+    return index;
+}
+
+// Internal function that publishes `index` as a hazard, then confirms the
+// anchor still equals `anchor`.  Once confirmed, the node cannot be reused
+// until the hazard is cleared.
+static bool internal_protect(ConcurrentListHandle *handle, size_t const slot,
+                             uint32_t const index, uint64_t const anchor)
+{
+    atomic_store(&handle->record->hazards[slot], index);
+    return atomic_load(&handle->list->anchor) == anchor;
+}
+
+// Internal function that clears the hazards of the handle.  A release store
+// is enough, it only has to make the reads of the nodes happen before another
+// thread that sees the hazard cleared reuses them.
+static void internal_clear_hazards(ConcurrentListHandle *handle)
+{
+    for (size_t i = 0; i < CONCURRENT_LIST_HAZARDS_PER_HANDLE; ++i)
+    {
+        atomic_store_explicit(&handle->record->hazards[i], 0, memory_order_release);
+    }
+}
+
+// Internal function that returns every retired node no thread holds as a
+// hazard to the free list, keeping the rest for a later check.
+static void internal_reclaim(ConcurrentListHandle *handle)
+{
+    ConcurrentIntegerList *list = handle->list;
+    uint32_t hazards[CONCURRENT_LIST_MAXIMUM_HANDLES * CONCURRENT_LIST_HAZARDS_PER_HANDLE];
+    size_t hazardCount = 0;
+
+    // Collect the hazards of every thread.
+    for (size_t i = 0; i < CONCURRENT_LIST_MAXIMUM_HANDLES; ++i)
+    {
+        for (size_t j = 0; j < CONCURRENT_LIST_HAZARDS_PER_HANDLE; ++j)
+        {
+            uint32_t const hazard = atomic_load(&list->records[i].hazards[j]);
+
+            if (hazard) { hazards[hazardCount++] = hazard; }
+        }
+    }
+
+    // Chain every unprotected node together through its `nextFree` index,
+    // keeping protected nodes at the start of the retired array.
+    uint32_t first = 0;
+    uint32_t last = 0;
+    size_t kept = 0;
+
+    for (size_t i = 0; i < handle->retiredCount; ++i)
+    {
+        uint32_t const index = handle->retired[i];
+        bool protected = false;
+
+        for (size_t j = 0; j < hazardCount && !protected; ++j)
+        {
+            protected = hazards[j] == index;
+        }
+
+        if (protected)
+        {
+            handle->retired[kept++] = index;
+            continue;
+        }
+
+        atomic_store(&internal_node(list, index)->nextFree, first);
+        if (!first) { last = index; }
+        first = index;
+    }
+
+    handle->retiredCount = kept;
+
+    if (!first) { return; }
+
+    // Push the whole chain onto the free list at once.
+    uint64_t head = atomic_load(&list->freeList);
+    uint64_t replacement;
+
+    do
+    {
+        atomic_store(&internal_node(list, last)->nextFree, (uint32_t)head);
+        replacement = ((head >> 32) + 1) << 32 | first;
+    } while (!atomic_compare_exchange_weak(&list->freeList, &head, replacement));
+}
+
+// Internal function that retires a popped node, reclaiming retired nodes
+// once enough of them have been collected.
+static void internal_retire(ConcurrentListHandle *handle, uint32_t const index)
+{
+    handle->retired[handle->retiredCount++] = index;
+
+    if (handle->retiredCount == RETIRE_THRESHOLD)
+    {
+        internal_reclaim(handle);
+    }
+}
+
+// Internal function that finishes a push to the back described by `anchor`,
+// linking the previous back node to the new one and marking the anchor
+// stable.  Returns without effect if another thread has already done so.
+static void internal_stabilize_back(ConcurrentListHandle *handle, uint64_t const anchor)
+{
+    ConcurrentIntegerList *list = handle->list;
+    uint32_t const back = internal_anchor_back(anchor);
+
+    if (!internal_protect(handle, 0, back, anchor)) { return; }
+
+    uint32_t const previous = atomic_load(&internal_node(list, back)->left);
+
+    if (!internal_protect(handle, 1, previous, anchor)) { return; }
+
+    // Link the previous node to the new back node, unless that is done.
+    _Atomic uint32_t *link = &internal_node(list, previous)->right;
+    uint32_t linked = atomic_load(link);
+
+    // The node it is linked to may be an old back node, popped since, so it
+    // is protected too, or it could be pushed again and make the exchange
+    // overwrite a link that is already finished.  A missing link is zero,
+    // which is never reused.
+    if (linked != back)
+    {
+        if (linked && !internal_protect(handle, 2, linked, anchor)) { return; }
+        if (!atomic_compare_exchange_strong(link, &linked, back)) { return; }
+    }
+
+    uint64_t expected = anchor;
+    atomic_compare_exchange_strong(&list->anchor, &expected,
+                                   internal_make_anchor(anchor, internal_anchor_front(anchor),
+                                                        back, ANCHOR_STABLE));
+}
+
+// Internal function that finishes a push to the front described by `anchor`,
+// the mirror image of internal_stabilize_back().
+static void internal_stabilize_front(ConcurrentListHandle *handle, uint64_t const anchor)
+{
+    ConcurrentIntegerList *list = handle->list;
+    uint32_t const front = internal_anchor_front(anchor);
+
+    if (!internal_protect(handle, 0, front, anchor)) { return; }
+
+    uint32_t const next = atomic_load(&internal_node(list, front)->right);
+
+    if (!internal_protect(handle, 1, next, anchor)) { return; }
+
+    // Link the next node to the new front node, unless that is done.
+    _Atomic uint32_t *link = &internal_node(list, next)->left;
+    uint32_t linked = atomic_load(link);
+
+    if (linked != front)
+    {
+        if (linked && !internal_protect(handle, 2, linked, anchor)) { return; }
+        if (!atomic_compare_exchange_strong(link, &linked, front)) { return; }
+    }
+
+    uint64_t expected = anchor;
+    atomic_compare_exchange_strong(&list->anchor, &expected,
+                                   internal_make_anchor(anchor, front,
+                                                        internal_anchor_back(anchor),
+                                                        ANCHOR_STABLE));
+}
+
+// Internal function that finishes whichever push left `anchor` unstable.
+static void internal_stabilize(ConcurrentListHandle *handle, uint64_t const anchor)
+{
+    if (internal_anchor_status(anchor) == ANCHOR_PUSHED_BACK)
+    {
+        internal_stabilize_back(handle, anchor);
+    }
+    else
+    {
+        internal_stabilize_front(handle, anchor);
+    }
+}
+
+// Initializes an empty concurrent list.  Must be called before any thread
+// attaches to the list.
+void concurrent_list_initialize(ConcurrentIntegerList *list)
+{
+    // Zero is the stable anchor of an empty list.
+    atomic_init(&list->anchor, 0);
+    atomic_init(&list->freeList, 0);
+    atomic_init(&list->nextIndex, 1);
+
+    // The segment table covers every index up front, the segments themselves
+    // are only allocated once nodes are taken from them.
+    list->segments = calloc(SEGMENT_COUNT, sizeof(*list->segments));
+    list->records = calloc(CONCURRENT_LIST_MAXIMUM_HANDLES, sizeof(ConcurrentHazardRecord));
+
+    if (!list->segments || !list->records) { internal_bad_alloc(); }
+}
+
+// Frees every node of the list.  No thread may be attached to the list.
+void concurrent_list_cleanup(ConcurrentIntegerList *list)
+{
+    // Segments are allocated in index order, so the first missing segment
+    // ends the allocated ones.
+    for (size_t i = 0; i < SEGMENT_COUNT; ++i)
+    {
+        ConcurrentNode *segment = atomic_load(&list->segments[i]);
+
+        if (!segment) { break; }
+
+        free(segment);
+    }
+
+    free((void *)list->segments);
+    free(list->records);
+    list->segments = NULL;
+    list->records = NULL;
+}
+
+// Attaches the calling thread to the list through `handle`, which the thread
+// passes to every push and pop.  Returns false if the maximum number of
+// handles are already attached.
+bool concurrent_list_attach(ConcurrentIntegerList *list, ConcurrentListHandle *handle)
+{
+    handle->retired = malloc(RETIRE_THRESHOLD * sizeof(uint32_t));
+
+    if (!handle->retired) { internal_bad_alloc(); }
+
+    // Claim the first hazard record no other handle owns.
+    for (size_t i = 0; i < CONCURRENT_LIST_MAXIMUM_HANDLES; ++i)
+    {
+        uint32_t expected = 0;
+
+        if (atomic_compare_exchange_strong(&list->records[i].active, &expected, 1))
+        {
+            handle->list = list;
+            handle->record = &list->records[i];
+            handle->retiredCount = 0;
+            return true;
+        }
+    }
+
+    free(handle->retired);
+    handle->retired = NULL;
+    return false;
+}
+
+// Detaches a handle from its list, waiting until every node it popped can be
+// reused, and releases its hazard record for another thread.
+void concurrent_list_detach(ConcurrentListHandle *handle)
+{
+    // Other threads only hold hazards for the duration of a push or pop.
+    internal_reclaim(handle);
+
+    while (handle->retiredCount)
+    {
+        platform_thread_yield();
+        internal_reclaim(handle);
+    }
+
+    free(handle->retired);
+    atomic_store(&handle->record->active, 0);
+    handle->retired = NULL;
+    handle->record = NULL;
+    handle->list = NULL;
+}
+
+// Adds a node with the specified value to the back of the list.
+void concurrent_list_push_back(ConcurrentListHandle *handle, int const value)
+{
+    ConcurrentIntegerList *list = handle->list;
+    uint32_t const index = internal_allocate(list);
+    ConcurrentNode *node = internal_node(list, index);
+
+    node->data = value;
+    atomic_store(&node->right, 0);
+
+    for (;;)
+    {
+        uint64_t anchor = atomic_load(&list->anchor);
+        uint32_t const front = internal_anchor_front(anchor);
+        uint32_t const back = internal_anchor_back(anchor);
+
+        // If the list is empty, the node becomes both ends.
+        if (!back)
+        {
+            atomic_store(&node->left, 0);
+            uint64_t const single = internal_make_anchor(anchor, index, index, ANCHOR_STABLE);
+
+            if (atomic_compare_exchange_weak(&list->anchor, &anchor, single))
+            {
+                break;
+            }
+        }
+        // Otherwise point the node at the back node, swing the back of the
+        // anchor to the node, then link the old back node to it.
+        else if (internal_anchor_status(anchor) == ANCHOR_STABLE)
+        {
+            atomic_store(&node->left, back);
+            uint64_t const pushed = internal_make_anchor(anchor, front, index, ANCHOR_PUSHED_BACK);
+
+            if (atomic_compare_exchange_weak(&list->anchor, &anchor, pushed))
+            {
+                internal_stabilize_back(handle, pushed);
+                break;
+            }
+        }
+        // Finish the push of another thread before trying again.
+        else
+        {
+            internal_stabilize(handle, anchor);
+        }
+    }
+
+    internal_clear_hazards(handle);
+}
+
+// Adds a node with the specified value to the front of the list.
+void concurrent_list_push_front(ConcurrentListHandle *handle, int const value)
+{
+    ConcurrentIntegerList *list = handle->list;
+    uint32_t const index = internal_allocate(list);
+    ConcurrentNode *node = internal_node(list, index);
+
+    node->data = value;
+    atomic_store(&node->left, 0);
+
+    for (;;)
+    {
+        uint64_t anchor = atomic_load(&list->anchor);
+        uint32_t const front = internal_anchor_front(anchor);
+        uint32_t const back = internal_anchor_back(anchor);
+
+        // If the list is empty, the node becomes both ends.
+        if (!front)
+        {
+            atomic_store(&node->right, 0);
+            uint64_t const single = internal_make_anchor(anchor, index, index, ANCHOR_STABLE);
+
+            if (atomic_compare_exchange_weak(&list->anchor, &anchor, single))
+            {
+                break;
+            }
+        }
+        // Otherwise point the node at the front node, swing the front of the
+        // anchor to the node, then link the old front node to it.
+        else if (internal_anchor_status(anchor) == ANCHOR_STABLE)
+        {
+            atomic_store(&node->right, front);
+            uint64_t const pushed = internal_make_anchor(anchor, index, back, ANCHOR_PUSHED_FRONT);
+
+            if (atomic_compare_exchange_weak(&list->anchor, &anchor, pushed))
+            {
+                internal_stabilize_front(handle, pushed);
+                break;
+            }
+        }
+        // Finish the push of another thread before trying again.
+        else
+        {
+            internal_stabilize(handle, anchor);
+        }
+    }
+
+    internal_clear_hazards(handle);
+}
+
+// Removes the last node in the list, storing its value in `value`.  Returns
+// false if the list is empty.
+bool concurrent_list_try_pop_back(ConcurrentListHandle *handle, int *value)
+{
+    ConcurrentIntegerList *list = handle->list;
+    uint32_t back;
+
+    for (;;)
+    {
+        uint64_t anchor = atomic_load(&list->anchor);
+        uint32_t const front = internal_anchor_front(anchor);
+        AnchorStatus const status = internal_anchor_status(anchor);
+
+        back = internal_anchor_back(anchor);
+
+        if (!back)
+        {
+            internal_clear_hazards(handle);
+            return false;
+        }
+
+        // Protect the back node so it can be read after it is unlinked.
+        if (!internal_protect(handle, 0, back, anchor)) { continue; }
+
+        // A single node leaves the list empty.
+        if (front == back)
+        {
+            if (atomic_compare_exchange_weak(&list->anchor, &anchor,
+                                             internal_make_anchor(anchor, 0, 0, status)))
+            {
+                break;
+            }
+        }
+        // Otherwise the node in front of it becomes the back node.
+        else if (status == ANCHOR_STABLE)
+        {
+            uint32_t const previous = atomic_load(&internal_node(list, back)->left);
+
+            if (atomic_compare_exchange_weak(&list->anchor, &anchor,
+                                             internal_make_anchor(anchor, front, previous, status)))
+            {
+                break;
+            }
+        }
+        // Finish the push of another thread before trying again.
+        else
+        {
+            internal_stabilize(handle, anchor);
+        }
+    }
+
+    *value = internal_node(list, back)->data;
+    internal_clear_hazards(handle);
+    internal_retire(handle, back);
+    return true;
+}
+
+// Removes the first node in the list, storing its value in `value`.  Returns
+// false if the list is empty.
+bool concurrent_list_try_pop_front(ConcurrentListHandle *handle, int *value)
+{
+    ConcurrentIntegerList *list = handle->list;
+    uint32_t front;
+
+    for (;;)
+    {
+        uint64_t anchor = atomic_load(&list->anchor);
+        uint32_t const back = internal_anchor_back(anchor);
+        AnchorStatus const status = internal_anchor_status(anchor);
+
+        front = internal_anchor_front(anchor);
+
+        if (!front)
+        {
+            internal_clear_hazards(handle);
+            return false;
+        }
+
+        // Protect the front node so it can be read after it is unlinked.
+        if (!internal_protect(handle, 0, front, anchor)) { continue; }
+
+        // A single node leaves the list empty.
+        if (front == back)
+        {
+            if (atomic_compare_exchange_weak(&list->anchor, &anchor,
+                                             internal_make_anchor(anchor, 0, 0, status)))
+            {
+                break;
+            }
+        }
+        // Otherwise the node behind it becomes the front node.
+        else if (status == ANCHOR_STABLE)
+        {
+            uint32_t const next = atomic_load(&internal_node(list, front)->right);
+
+            if (atomic_compare_exchange_weak(&list->anchor, &anchor,
+                                             internal_make_anchor(anchor, next, back, status)))
+            {
+                break;
+            }
+        }
+        // Finish the push of another thread before trying again.
+        else
+        {
+            internal_stabilize(handle, anchor);
+        }
+    }
+
+    *value = internal_node(list, front)->data;
+    internal_clear_hazards(handle);
+    internal_retire(handle, front);
+    return true;
+}
+
+// Removes the last node in the list, if there is one.
+void concurrent_list_pop_back(ConcurrentListHandle *handle)
+{
+    int value;
+    concurrent_list_try_pop_back(handle, &value);
+}
+
+// Removes the first node in the list, if there is one.
+void concurrent_list_pop_front(ConcurrentListHandle *handle)
+{
+    int value;
+    concurrent_list_try_pop_front(handle, &value);
+}
+
+// Returns true if the list held no nodes at the moment it was checked.
+bool concurrent_list_is_empty(ConcurrentIntegerList const *list)
+{
+    return internal_anchor_back(atomic_load(&list->anchor)) == 0;
+}
@@ -0,0 +1,121 @@
+/*
+* File Name: concurrent_linked_list.h
+* Purpose: Contains the structure definitions and function declarations for
+*          the lock-free deque variant of my linked list implementation,
+*          which many threads may push to and pop from at both ends.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_CONCURRENT_LINKED_LIST_H
+#define BACHURSKI_CONCURRENT_LINKED_LIST_H
+
+// Include required stdlib headers.
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Defines a constant for the number of threads that may hold a handle to the
+// same list at once.
+#define CONCURRENT_LIST_MAXIMUM_HANDLES 64
+
+// Defines a constant for the number of nodes each thread may protect from
+// reuse while it works on the list.
+#define CONCURRENT_LIST_HAZARDS_PER_HANDLE 3
+
+// Defines a constant for the size of a cache line, fields written by
+// different threads are kept on separate lines.
+#define CONCURRENT_LIST_CACHE_LINE 64
+
+// Definition for a concurrent list node.
+// Nodes refer to each other by index rather than by pointer, so that both
+// ends of the list, a status and a counter fit in a single atomic word.
+// Contains:
+// - Index of the `left` (front side) neighbour, zero for none.
+// - Index of the `right` (back side) neighbour, zero for none.
+// - Index of the next node in the free list while the node is unused.
+// - Integer value being stored.
+typedef struct ConcurrentNode
+{
+    _Atomic uint32_t left;
+    _Atomic uint32_t right;
+    _Atomic uint32_t nextFree;
+    int data;
+} ConcurrentNode;
+
+// Definition for the hazards of a single thread, padded to a cache line.
+// Contains:
+// - Whether a handle currently owns the record.
+// - Indices of the nodes the owning thread is reading, zero for none.
+typedef struct ConcurrentHazardRecord
+{
+    _Atomic uint32_t active;
+    _Atomic uint32_t hazards[CONCURRENT_LIST_HAZARDS_PER_HANDLE];
+    char padding[CONCURRENT_LIST_CACHE_LINE
+                 - (1 + CONCURRENT_LIST_HAZARDS_PER_HANDLE) * sizeof(uint32_t)];
+} ConcurrentHazardRecord;
+
+// Definition for a concurrent list.
+// Contains:
+// - Anchor packing the front index, back index, status and a counter that
+//   changes on every update into one word.
+// - Head of the free list, packing a node index and a counter that changes
+//   on every update.
+// - Index the next never used node is taken from.
+// - Table of the segments nodes are stored in, allocated as they are needed.
+// - Hazard records of every thread able to hold a handle.
+typedef struct ConcurrentIntegerList
+{
+    _Atomic uint64_t anchor;
+    char anchorPadding[CONCURRENT_LIST_CACHE_LINE - sizeof(uint64_t)];
+    _Atomic uint64_t freeList;
+    _Atomic uint32_t nextIndex;
+    _Atomic(ConcurrentNode *) *segments;
+    ConcurrentHazardRecord *records;
+} ConcurrentIntegerList;
+
+// Definition for the handle a single thread uses to reach a concurrent list.
+// Handles must not be shared between threads.
+// Contains:
+// - Pointer to the list.
+// - Pointer to the hazard record owned by this handle.
+// - Indices of popped nodes waiting until no thread reads them.
+// - Number of popped nodes waiting.
+typedef struct ConcurrentListHandle
+{
+    ConcurrentIntegerList *list;
+    ConcurrentHazardRecord *record;
+    uint32_t *retired;
+    size_t retiredCount;
+} ConcurrentListHandle;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying concurrent_linked_list.c
+    * file.
+*/
+
+// Lifetime
+void concurrent_list_initialize(ConcurrentIntegerList *list);
+void concurrent_list_cleanup(ConcurrentIntegerList *list);
+bool concurrent_list_attach(ConcurrentIntegerList *list, ConcurrentListHandle *handle);
+void concurrent_list_detach(ConcurrentListHandle *handle);
+
+// Adding Elements
+void concurrent_list_push_back(ConcurrentListHandle *handle, int const value);
+void concurrent_list_push_front(ConcurrentListHandle *handle, int const value);
+
+// Removing Elements
+void concurrent_list_pop_back(ConcurrentListHandle *handle);
+void concurrent_list_pop_front(ConcurrentListHandle *handle);
+bool concurrent_list_try_pop_back(ConcurrentListHandle *handle, int *value);
+bool concurrent_list_try_pop_front(ConcurrentListHandle *handle, int *value);
+
+// Inspection
+bool concurrent_list_is_empty(ConcurrentIntegerList const *list);
+
+// End of header guard.
+#endif
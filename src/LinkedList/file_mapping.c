@@ -0,0 +1,139 @@
+/*
+* File Name: file_mapping.c
+* Purpose: Contains the platform dependent function definitions used by my
+*          linked list implementation to map files into memory for reading.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Request the POSIX declarations, which strict ISO C builds hide.  This has to
+// come before the first header is included.
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+// Include the header for file mapping.
+#include "file_mapping.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+
+// Include the platform headers which provide memory mapping.
+// Conditional compilation for Windows environment.
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+// Conditional compilation for Unix environment.
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+// End conditional compilation.
+#endif
+
+// Maps the entire file of the provided name into memory for reading.
+// Returns false if the file cannot be opened or mapped.  An empty file is
+// mapped successfully with a null `data` pointer and a `length` of zero.
+bool file_mapping_open(MappedFile *mapping, char const *fileName)
+{
+    // Start from an empty mapping so that close() is always safe to call.
+    mapping->data = NULL;
+    mapping->length = 0;
+    mapping->handle = NULL;
+
+// Conditional compilation for Windows environment.
+#if defined(_WIN32) || defined(_WIN64)
+    // Open the file for reading.
+    HANDLE file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) { return false; }
+
+    // Query the size of the file, an empty file cannot be mapped.
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    if (size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return true;
+    }
+
+    // Create a read-only mapping object, which keeps the file alive on its
+    // own, so the file handle can be closed right away.
+    HANDLE mappingObject = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mappingObject) { return false; }
+
+    // Map a view of the whole file.
+    void *view = MapViewOfFile(mappingObject, FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+    {
+        CloseHandle(mappingObject);
+        return false;
+    }
+
+    mapping->data = (char const *)view;
+    mapping->length = (size_t)size.QuadPart;
+    mapping->handle = mappingObject;
+// Conditional compilation for Unix environment.
+#else
+    // Open the file for reading.
+    int file = open(fileName, O_RDONLY);
+    if (file < 0) { return false; }
+
+    // Query the size of the file, an empty file cannot be mapped.
+    struct stat status;
+    if (fstat(file, &status) != 0)
+    {
+        close(file);
+        return false;
+    }
+
+    if (status.st_size == 0)
+    {
+        close(file);
+        return true;
+    }
+
+    // Map the whole file, the mapping stays valid after the descriptor closes.
+    void *view = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (view == MAP_FAILED) { return false; }
+
+    // The file is read front to back, let the kernel read ahead aggressively.
+    posix_madvise(view, (size_t)status.st_size, POSIX_MADV_SEQUENTIAL);
+
+    mapping->data = (char const *)view;
+    mapping->length = (size_t)status.st_size;
+// End conditional compilation.
+#endif
+
+    return true;
+}
+
+// Releases a mapping created by file_mapping_open().
+void file_mapping_close(MappedFile *mapping)
+{
+    // Empty files were never mapped.
+    if (!mapping->data) { return; }
+
+// Conditional compilation for Windows environment.
+#if defined(_WIN32) || defined(_WIN64)
+    UnmapViewOfFile(mapping->data);
+    CloseHandle((HANDLE)mapping->handle);
+// Conditional compilation for Unix environment.
+#else
+    munmap((void *)mapping->data, mapping->length);
+// End conditional compilation.
+#endif
+
+    mapping->data = NULL;
+    mapping->length = 0;
+    mapping->handle = NULL;
+}
@@ -0,0 +1,39 @@
+/*
+* File Name: file_mapping.h
+* Purpose: Contains the private type and function declarations used by my
+*          linked list implementation to map files into memory for reading.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_FILE_MAPPING_H
+#define BACHURSKI_FILE_MAPPING_H
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+
+// Read-only view of an entire file.
+// Contains:
+// - Pointer to the first byte of the file, null for an empty file.
+// - Number of bytes in the file.
+// - Platform specific handle needed to release the mapping.
+typedef struct MappedFile
+{
+    char const *data;
+    size_t length;
+    void *handle;
+} MappedFile;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying file_mapping.c file.
+*/
+
+bool file_mapping_open(MappedFile *mapping, char const *fileName);
+void file_mapping_close(MappedFile *mapping);
+
+// End of header guard.
+#endif
@@ -0,0 +1,2126 @@
+/*
+* File Name: generic_linked_list.h
+* Purpose: Contains macros which generate a doubly linked list for any element
+*          type, storing each element inline in its node.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_GENERIC_LINKED_LIST_H
+#define BACHURSKI_GENERIC_LINKED_LIST_H
+
+// Include the private pool every node is allocated from, and the helpers used
+// to read, parse, and write lists.
+#include "file_mapping.h"
+#include "node_pool.h"
+#include "output_buffer.h"
+#include "platform_thread.h"
+#include "text_scanner.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+    * Usage
+    *
+    * DECLARE_LINKED_LIST(Name, prefix, type) declares the types and functions
+    * of a list of `type` elements, and belongs in a header.  The list handle
+    * is called `Name`, and every function starts with `prefix`, for example
+    * `prefix_push_back()`.
+    *
+    * DEFINE_LINKED_LIST(Name, prefix, type, traits) defines those functions,
+    * and belongs in exactly one source file.  `traits` names a family of
+    * function-like macros, or functions, that handle the elements:
+    * - traits_EQUAL(a, b) and traits_LESS(a, b) compare two elements through
+    *   pointers, `type const *`, for searching and sorting.
+    * - traits_HASH(value) hashes the element `value` points to into an
+    *   unsigned integer, equal for equal elements, for remove_values().
+    * - traits_FORMAT(buffer, value) appends the element `value` points to to
+    *   an OutputBuffer, for output_to_file() and print_list().
+    * - traits_PARSE(scanner, value) reads the next element from a
+    *   TextScanner into `value`, returning a TextScanStatus, for loading.
+    * LINKED_LIST_SCALAR_EQUAL and LINKED_LIST_SCALAR_LESS compare scalar
+    * types with == and <, and LINKED_LIST_INTEGER_HASH hashes integer types.
+    *
+    * The functions mirror linked_list.h, IntegerLinkedList is itself
+    * generated by these macros.  Nodes are carved from slabs of a NodePool,
+    * so no element is ever allocated separately.  Accessors return elements
+    * by value, use prefix_iterator_element() to reach large elements in place.
+    *
+    * DECLARE_LINKED_LIST_WITH_FIELDS() and DEFINE_LINKED_LIST_WITH_HOOKS()
+    * extend a list.  `fields()` expands to extra members of the handle, and
+    * `hooks` names a family of macros called as the list changes, see
+    * LINKED_LIST_NO_HOOKS below for each of them.  A header which lists the
+    * functions itself, like linked_list.h, declares only the types with
+    * DECLARE_LINKED_LIST_TYPES().
+*/
+
+// Load Report
+// Contains:
+// - Number of values read from the file and appended to the list.
+// - Whether reading stopped at text which is not a valid element.
+// - Byte offset, line and column (both starting at one) of that text.
+typedef struct LinkedListLoadReport
+{
+    size_t valuesRead;
+    bool parseError;
+    size_t errorOffset;
+    size_t errorLine;
+    size_t errorColumn;
+} LinkedListLoadReport;
+
+// Defines comparisons for the traits of DEFINE_LINKED_LIST, for element types
+// which can be compared with == and <.
+#define LINKED_LIST_SCALAR_EQUAL(a, b) (*(a) == *(b))
+#define LINKED_LIST_SCALAR_LESS(a, b) (*(a) < *(b))
+
+// Defines a hash for the traits of DEFINE_LINKED_LIST, for integer element
+// types.  Multiplying by a large odd constant spreads consecutive values
+// across a table, like the value index does.
+#define LINKED_LIST_INTEGER_HASH(value)                                                      \
+    (((unsigned long long)*(value) * 0x9E3779B97F4A7C15ULL) >> 32)
+
+// Defines a constant which will be used to check the string length of the
+// file name passed to load_data_from_file() and output_to_file().
+#define GENERIC_LIST_MINIMUM_NAME_LENGTH 4
+
+// Defines constants for when a list with automatic compaction compacts itself,
+// once it holds at least GENERIC_LIST_AUTO_COMPACT_MINIMUM_SIZE nodes and more
+// than one in GENERIC_LIST_AUTO_COMPACT_RATIO of them were placed away from
+// their neighbors.
+#define GENERIC_LIST_AUTO_COMPACT_MINIMUM_SIZE 1024
+#define GENERIC_LIST_AUTO_COMPACT_RATIO 4
+
+// Defines the number of elements parsed from a file before they are appended
+// to the list together, as many as fit in GENERIC_LIST_BATCH_BYTES.
+#define GENERIC_LIST_BATCH_BYTES 16384
+#define GENERIC_LIST_BATCH_LENGTH(type)                                                      \
+    (sizeof(type) < GENERIC_LIST_BATCH_BYTES ? GENERIC_LIST_BATCH_BYTES / sizeof(type) : 1)
+
+// Defines a constant for the number of bins used by the merge sort, one per
+// bit of the number of runs a list can hold.
+#define GENERIC_LIST_SORT_BIN_COUNT 64
+
+// Defines constants for the parallel loader, which gives each thread at least
+// GENERIC_LIST_PARALLEL_LOAD_MINIMUM_BYTES of the file and uses at most
+// GENERIC_LIST_PARALLEL_LOAD_MAXIMUM_THREADS threads.
+#define GENERIC_LIST_PARALLEL_LOAD_MINIMUM_BYTES (64 * 1024)
+#define GENERIC_LIST_PARALLEL_LOAD_MAXIMUM_THREADS 64
+
+// Defines the extra members of a handle without any, for DECLARE_LINKED_LIST.
+#define LINKED_LIST_NO_FIELDS()
+
+// Defines the hooks of a list without any, for DEFINE_LINKED_LIST.  Each hook
+// names its arguments in a discarded expression, so that no argument is
+// reported as unused.
+// - INITIALIZE(list) prepares the extra members before the pool is created,
+//   returning false if allocation fails.  CLEANUP(list) releases them after
+//   the pool has been released.
+// - POOL_CREATED(list, pool) and POOL_RELEASED(list, pool) are called when
+//   the list creates a pool, and when it stops sharing a pool with others.
+// - TRACKED(list) is true while nodes are recorded.  RECORD(list, node) and
+//   FORGET(list, node) are called for every node added to and removed from
+//   the list, CLEAR(list) when every node is removed at once, and
+//   RELOCATED(list) once compaction has moved every node.
+// - INDEXED(list) is true while INDEX_COUNT(list, value) returns the number
+//   of nodes storing a value, and INDEX_ANY(list, value) one of them or null.
+//   PREPARE_INDEX(list) is called by remove_value() and remove_values()
+//   before INDEXED, so that an index deferred until the first lookup through
+//   a non-const handle can be built there.
+// - CHANGED(list) is called whenever nodes are added, removed or reordered.
+// - BEGIN(list) and END(list, operation) surround every public function, and
+//   TRAVERSED(list, count) and COUNT(list, field, count) report the nodes it
+//   walked past and took from or returned to the pool.
+#define LINKED_LIST_NO_HOOKS_INITIALIZE(list) ((void)(list), true)
+#define LINKED_LIST_NO_HOOKS_CLEANUP(list) ((void)(list))
+#define LINKED_LIST_NO_HOOKS_POOL_CREATED(list, pool) ((void)(list), (void)(pool))
+#define LINKED_LIST_NO_HOOKS_POOL_RELEASED(list, pool) ((void)(list), (void)(pool))
+#define LINKED_LIST_NO_HOOKS_TRACKED(list) ((void)(list), false)
+#define LINKED_LIST_NO_HOOKS_RECORD(list, node) ((void)(list), (void)(node))
+#define LINKED_LIST_NO_HOOKS_FORGET(list, node) ((void)(list), (void)(node))
+#define LINKED_LIST_NO_HOOKS_CLEAR(list) ((void)(list))
+#define LINKED_LIST_NO_HOOKS_RELOCATED(list) ((void)(list))
+#define LINKED_LIST_NO_HOOKS_INDEXED(list) ((void)(list), false)
+#define LINKED_LIST_NO_HOOKS_INDEX_COUNT(list, value) ((void)(list), (void)(value), (size_t)0)
+#define LINKED_LIST_NO_HOOKS_INDEX_ANY(list, value) ((void)(list), (void)(value), NULL)
+#define LINKED_LIST_NO_HOOKS_PREPARE_INDEX(list) ((void)(list))
+#define LINKED_LIST_NO_HOOKS_CHANGED(list) ((void)(list))
+#define LINKED_LIST_NO_HOOKS_BEGIN(list) ((void)(list))
+#define LINKED_LIST_NO_HOOKS_END(list, operation) ((void)(list))
+#define LINKED_LIST_NO_HOOKS_TRAVERSED(list, count) ((void)sizeof(count))
+#define LINKED_LIST_NO_HOOKS_COUNT(list, field, count) ((void)(list))
+
+// Declares the types and functions of a list of `type` elements.
+#define DECLARE_LINKED_LIST(Name, prefix, type)                                              \
+    DECLARE_LINKED_LIST_WITH_FIELDS(Name, prefix, type, LINKED_LIST_NO_FIELDS)
+
+// Declares the types and functions of a list of `type` elements, whose handle
+// ends with the members `fields()` expands to.
+#define DECLARE_LINKED_LIST_WITH_FIELDS(Name, prefix, type, fields)                          \
+    DECLARE_LINKED_LIST_TYPES(Name, type, fields)                                            \
+    DECLARE_LINKED_LIST_FUNCTIONS(Name, prefix, type)
+
+// Declares the types of a list of `type` elements, for a header which lists
+// the functions itself.
+// Generates:
+// - Name##Node, holding pointers to the `next` and `previous` nodes and the
+//   element itself.
+// - Name##Cursor, remembering the most recently accessed node and its index.
+//   It is allocated apart from the handle, so that element_at() can move it
+//   through a const handle without writing to the handle itself.
+// - Name, the list handle, holding the ends of the list, its number of
+//   elements, the pool its nodes are allocated from, its cursor, whether it
+//   compacts itself and how many of its nodes are scattered, and whether it
+//   keeps its elements sorted.
+// - Name##Iterator, holding the current node and its index.
+// - Name##Predicate, deciding whether an element matches, called with the
+//   element and the context pointer passed along with the predicate.
+#define DECLARE_LINKED_LIST_TYPES(Name, type, fields)                                        \
+                                                                                             \
+    typedef struct Name##Node                                                                \
+    {                                                                                        \
+        struct Name##Node *next;                                                             \
+        struct Name##Node *previous;                                                         \
+        type data;                                                                           \
+    } Name##Node;                                                                            \
+                                                                                             \
+    typedef struct Name##Cursor                                                              \
+    {                                                                                        \
+        Name##Node *node;                                                                    \
+        size_t index;                                                                        \
+    } Name##Cursor;                                                                          \
+                                                                                             \
+    typedef struct Name                                                                      \
+    {                                                                                        \
+        Name##Node *head;                                                                    \
+        Name##Node *tail;                                                                    \
+        size_t size;                                                                         \
+        NodePool *pool;                                                                      \
+        Name##Cursor *cursor;                                                                \
+        bool autoCompact;                                                                    \
+        size_t scatteredNodes;                                                               \
+        bool sortedMode;                                                                     \
+        fields()                                                                             \
+    } Name;                                                                                  \
+                                                                                             \
+    typedef struct Name##Iterator                                                            \
+    {                                                                                        \
+        Name##Node *node;                                                                    \
+        size_t index;                                                                        \
+    } Name##Iterator;                                                                        \
+                                                                                             \
+    typedef bool (*Name##Predicate)(type const value, void *context);
+
+// Declares the functions of a list of `type` elements, which mirror the ones
+// linked_list.h lists for IntegerLinkedList, with the same general purposes.
+#define DECLARE_LINKED_LIST_FUNCTIONS(Name, prefix, type)                                    \
+                                                                                             \
+    /* Initialization */                                                                     \
+    bool prefix##_initialize(Name *list);                                                    \
+    void prefix##_load_data_from_file(Name *list, char const *fileName);                     \
+    bool prefix##_load_data_with_report(Name *list, char const *fileName,                    \
+                                        LinkedListLoadReport *report);                       \
+    bool prefix##_load_data_parallel(Name *list, char const *fileName,                       \
+                                     size_t const threadCount,                               \
+                                     LinkedListLoadReport *report);                          \
+                                                                                             \
+    /* Cleanup */                                                                            \
+    void prefix##_cleanup(Name *list);                                                       \
+    void prefix##_trim(Name *list);                                                          \
+    void prefix##_compact(Name *list);                                                       \
+    void prefix##_set_auto_compact(Name *list, bool const enabled);                          \
+                                                                                             \
+    /* Modifiers */                                                                          \
+    void prefix##_clear(Name *list);                                                         \
+    void prefix##_push_back(Name *list, type const value);                                   \
+    void prefix##_push_front(Name *list, type const value);                                  \
+    void prefix##_push_back_array(Name *list, type const *values, size_t const count);       \
+    void prefix##_push_front_array(Name *list, type const *values, size_t const count);      \
+    void prefix##_pop_back(Name *list);                                                      \
+    void prefix##_pop_front(Name *list);                                                     \
+    void prefix##_remove_at_index(Name *list, size_t const index);                           \
+    void prefix##_remove_value(Name *list, type const value);                                \
+    size_t prefix##_remove_if(Name *list, Name##Predicate const predicate, void *context);   \
+    size_t prefix##_remove_values(Name *list, type const *values, size_t const count);       \
+                                                                                             \
+    /* Splicing */                                                                           \
+    void prefix##_splice(Name *destination, size_t const position, Name *source,             \
+                         size_t const first, size_t const count);                            \
+    void prefix##_concat(Name *destination, Name *source);                                   \
+    void prefix##_split(Name *list, size_t const index, Name *tail);                         \
+                                                                                             \
+    /* Ordering */                                                                           \
+    void prefix##_sort(Name *list);                                                          \
+    void prefix##_set_sorted(Name *list, bool const enabled);                                \
+                                                                                             \
+    /* Element Access */                                                                     \
+    type prefix##_back(Name const *list);                                                    \
+    type prefix##_front(Name const *list);                                                   \
+    type prefix##_element_at(Name const *list, size_t const index);                          \
+    size_t prefix##_export_array(Name const *list, type *values, size_t const capacity);     \
+                                                                                             \
+    /* Iteration */                                                                          \
+    Name##Iterator prefix##_iterator_first(Name const *list);                                \
+    Name##Iterator prefix##_iterator_last(Name const *list);                                 \
+    Name##Iterator prefix##_iterator_at(Name const *list, size_t const index);               \
+    bool prefix##_iterator_valid(Name##Iterator const *iterator);                            \
+    type prefix##_iterator_value(Name##Iterator const *iterator);                            \
+    type *prefix##_iterator_element(Name##Iterator const *iterator);                         \
+    void prefix##_iterator_next(Name##Iterator *iterator);                                   \
+    void prefix##_iterator_previous(Name##Iterator *iterator);                               \
+                                                                                             \
+    /* Output */                                                                             \
+    void prefix##_output_to_file(Name *list, char const *fileName);                          \
+                                                                                             \
+    /* Search */                                                                             \
+    size_t prefix##_find_first_index_containing(Name const *list, type const value);         \
+    bool prefix##_contains(Name const *list, type const value);                              \
+                                                                                             \
+    /* Display */                                                                            \
+    void prefix##_print_list(Name const *list);                                              \
+    void prefix##_print_list_page(Name const *list, size_t const first, size_t const count);
+
+// Defines the functions declared by DECLARE_LINKED_LIST.
+#define DEFINE_LINKED_LIST(Name, prefix, type, traits)                                       \
+    DEFINE_LINKED_LIST_WITH_HOOKS(Name, prefix, type, traits, LINKED_LIST_NO_HOOKS)
+
+// Defines the functions declared by DECLARE_LINKED_LIST_WITH_FIELDS, calling
+// the `hooks` as the list changes.  They work like the functions of
+// linked_list.c: allocation failure and indices outside the list print a
+// diagnostic message and abort the program, and positional access starts from
+// whichever of the head, tail, or cursor is closest.  The definitions are
+// split into the GENERIC_LIST_DEFINE_* macros below, which are not meant to
+// be used on their own.
+#define DEFINE_LINKED_LIST_WITH_HOOKS(Name, prefix, type, traits, hooks)                     \
+    GENERIC_LIST_DEFINE_NODES(Name, prefix, type, traits, hooks)                             \
+    GENERIC_LIST_DEFINE_ORDERING(Name, prefix, type, traits, hooks)                          \
+    GENERIC_LIST_DEFINE_TRANSFER(Name, prefix, type, traits, hooks)                          \
+    GENERIC_LIST_DEFINE_LIFETIME(Name, prefix, type, traits, hooks)                          \
+    GENERIC_LIST_DEFINE_MODIFIERS(Name, prefix, type, traits, hooks)                         \
+    GENERIC_LIST_DEFINE_ACCESS(Name, prefix, type, traits, hooks)
+
+// Defines the internal functions which allocate, find, link, and unlink nodes.
+#define GENERIC_LIST_DEFINE_NODES(Name, prefix, type, traits, hooks)                         \
+                                                                                             \
+    /* Prints a diagnostic message and aborts if allocation fails. */                        \
+    static void prefix##_internal_bad_alloc(void)                                            \
+    {                                                                                        \
+        fprintf(stderr, "Memory allocation failed!\n");                                      \
+        abort();                                                                             \
+    }                                                                                        \
+                                                                                             \
+    /* Prints a diagnostic message and aborts if an index is out of range. */                \
+    static void prefix##_internal_out_of_bounds(size_t const size, size_t const index)       \
+    {                                                                                        \
+        fprintf(stderr, "Attempt to access index out of range!\n");                          \
+        fprintf(stderr, "Index %zu of list with size %zu.\n", index, size);                  \
+        abort();                                                                             \
+    }                                                                                        \
+                                                                                             \
+    /* Prints a diagnostic message and aborts if elements are moved from a */                \
+    /* list into the same list. */                                                           \
+    static void prefix##_internal_same_list(void)                                            \
+    {                                                                                        \
+        fprintf(stderr, "Attempt to move elements between a list and itself!\n");            \
+        abort();                                                                             \
+    }                                                                                        \
+                                                                                             \
+    /* Creates a pool for the nodes of the list.  Returns null if */                         \
+    /* allocation fails. */                                                                  \
+    static NodePool *prefix##_internal_create_pool(Name *list)                               \
+    {                                                                                        \
+        NodePool *pool = node_pool_create(sizeof(Name##Node));                               \
+                                                                                             \
+        /* Let the hooks attach anything they track to the new pool. */                      \
+        if (pool) { hooks##_POOL_CREATED(list, pool); }                                      \
+        return pool;                                                                         \
+    }                                                                                        \
+                                                                                             \
+    /* Takes a node from the pool, aborting if allocation fails. */                          \
+    static Name##Node *prefix##_internal_allocate_node(Name *list)                           \
+    {                                                                                        \
+        Name##Node *node = (Name##Node *)node_pool_acquire(list->pool);                      \
+        if (!node) { prefix##_internal_bad_alloc(); }                                        \
+                                                                                             \
+        hooks##_COUNT(list, nodesAcquired, 1);                                               \
+        return node;                                                                         \
+    }                                                                                        \
+                                                                                             \
+    /* Returns a node to the pool. */                                                        \
+    static void prefix##_internal_free_node(Name *list, Name##Node *node)                    \
+    {                                                                                        \
+        hooks##_COUNT(list, nodesReleased, 1);                                               \
+        node_pool_release(list->pool, node);                                                 \
+    }                                                                                        \
+                                                                                             \
+    /* Returns every node of the list to the pool one by one, used when */                   \
+    /* other lists share the pool, which then reuse the nodes. */                            \
+    static void prefix##_internal_release_nodes(Name *list)                                  \
+    {                                                                                        \
+        Name##Node *node = list->head;                                                       \
+        while (node)                                                                         \
+        {                                                                                    \
+            /* Read the next node before this one joins the free list. */                    \
+            Name##Node *next = node->next;                                                   \
+            node_pool_release(list->pool, node);                                             \
+            node = next;                                                                     \
+        }                                                                                    \
+    }                                                                                        \
+                                                                                             \
+    /* Stops the list from using its pool.  A pool no other list shares is */                \
+    /* destroyed along with every node, otherwise the nodes are returned. */                 \
+    static void prefix##_internal_release_pool(Name *list)                                   \
+    {                                                                                        \
+        NodePool *pool = list->pool;                                                         \
+                                                                                             \
+        if (pool->references == 1)                                                           \
+        {                                                                                    \
+            /* Freeing the slabs frees every node at once. */                                \
+            node_pool_destroy(pool);                                                         \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            /* The other lists keep the pool, and reuse the nodes. */                        \
+            prefix##_internal_release_nodes(list);                                           \
+            --pool->references;                                                              \
+            hooks##_POOL_RELEASED(list, pool);                                               \
+        }                                                                                    \
+                                                                                             \
+        list->pool = NULL;                                                                   \
+    }                                                                                        \
+                                                                                             \
+    /* Compacts the list if automatic compaction is on and enough of its */                  \
+    /* nodes are scattered, keeping the cost of compaction amortized. */                     \
+    static void prefix##_internal_auto_compact(Name *list)                                   \
+    {                                                                                        \
+        if (list->autoCompact && list->size >= GENERIC_LIST_AUTO_COMPACT_MINIMUM_SIZE &&     \
+            list->scatteredNodes > list->size / GENERIC_LIST_AUTO_COMPACT_RATIO)             \
+        {                                                                                    \
+            prefix##_compact(list);                                                          \
+        }                                                                                    \
+    }                                                                                        \
+                                                                                             \
+    /* Finds the node at an index within the list, walking from whichever */                 \
+    /* of the head, the tail, or the cursor is closest. */                                   \
+    static Name##Node *prefix##_internal_locate(Name const *list, size_t const index)        \
+    {                                                                                        \
+        /* Start from the head. */                                                           \
+        Name##Node *node = list->head;                                                       \
+        size_t position = 0;                                                                 \
+        size_t distance = index;                                                             \
+                                                                                             \
+        /* Start from the tail instead if it is closer. */                                   \
+        if (list->size - 1 - index < distance)                                               \
+        {                                                                                    \
+            node = list->tail;                                                               \
+            position = list->size - 1;                                                       \
+            distance = list->size - 1 - index;                                               \
+        }                                                                                    \
+                                                                                             \
+        /* Start from the cursor instead if it is closer still. */                           \
+        if (list->cursor->node)                                                              \
+        {                                                                                    \
+            size_t const cursorDistance = index > list->cursor->index                        \
+                                        ? index - list->cursor->index                        \
+                                        : list->cursor->index - index;                       \
+            if (cursorDistance < distance)                                                   \
+            {                                                                                \
+                node = list->cursor->node;                                                   \
+                position = list->cursor->index;                                              \
+                distance = cursorDistance;                                                   \
+            }                                                                                \
+        }                                                                                    \
+                                                                                             \
+        hooks##_TRAVERSED(list, distance);                                                   \
+                                                                                             \
+        /* Walk forward or backward until the index is reached. */                           \
+        while (position < index)                                                             \
+        {                                                                                    \
+            node = node->next;                                                               \
+            ++position;                                                                      \
+        }                                                                                    \
+        while (position > index)                                                             \
+        {                                                                                    \
+            node = node->previous;                                                           \
+            --position;                                                                      \
+        }                                                                                    \
+                                                                                             \
+        return node;                                                                         \
+    }                                                                                        \
+                                                                                             \
+    /* Finds the node at an index, then leaves the cursor on it.  The */                     \
+    /* cursor lives apart from the handle, so a const handle can move it. */                 \
+    static Name##Node *prefix##_internal_seek(Name const *list, size_t const index)          \
+    {                                                                                        \
+        Name##Node *node = prefix##_internal_locate(list, index);                            \
+        list->cursor->node = node;                                                           \
+        list->cursor->index = index;                                                         \
+        return node;                                                                         \
+    }                                                                                        \
+                                                                                             \
+    /* Unlinks a node from the list and returns it to the pool, keeping the */               \
+    /* head and tail valid.  The cursor must not point to the node. */                       \
+    static void prefix##_internal_unlink_node(Name *list, Name##Node *node)                  \
+    {                                                                                        \
+        hooks##_FORGET(list, node);                                                          \
+                                                                                             \
+        /* Removing a node between two others leaves a hole in memory. */                    \
+        if (node->previous && node->next) { ++list->scatteredNodes; }                        \
+                                                                                             \
+        /* Point the previous node past this one, or move the head. */                       \
+        if (node->previous)                                                                  \
+        {                                                                                    \
+            node->previous->next = node->next;                                               \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            list->head = node->next;                                                         \
+        }                                                                                    \
+                                                                                             \
+        /* Point the next node back past this one, or move the tail. */                      \
+        if (node->next)                                                                      \
+        {                                                                                    \
+            node->next->previous = node->previous;                                           \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            list->tail = node->previous;                                                     \
+        }                                                                                    \
+                                                                                             \
+        prefix##_internal_free_node(list, node);                                             \
+        --list->size;                                                                        \
+        hooks##_CHANGED(list);                                                               \
+    }                                                                                        \
+                                                                                             \
+    /* Unlinks the node at an index, keeping the cursor valid as well.  A */                 \
+    /* cursor on the node moves to the node taking its index, or to the */                   \
+    /* previous node, and a cursor after it moves down by one. */                            \
+    static void prefix##_internal_remove_node(Name *list, Name##Node *node,                  \
+                                              size_t const index)                            \
+    {                                                                                        \
+        if (list->cursor->node == node)                                                      \
+        {                                                                                    \
+            /* The next node takes over the index, unless this is the tail. */               \
+            if (node->next)                                                                  \
+            {                                                                                \
+                list->cursor->node = node->next;                                             \
+            }                                                                                \
+            else                                                                             \
+            {                                                                                \
+                list->cursor->node = node->previous;                                         \
+                --list->cursor->index;                                                       \
+            }                                                                                \
+        }                                                                                    \
+        else if (list->cursor->node && list->cursor->index > index)                          \
+        {                                                                                    \
+            --list->cursor->index;                                                           \
+        }                                                                                    \
+                                                                                             \
+        prefix##_internal_unlink_node(list, node);                                           \
+    }                                                                                        \
+                                                                                             \
+    /* Removes every node storing `value` through the index kept by the */                   \
+    /* hooks, without visiting any other node.  The positions of the nodes */                \
+    /* are unknown, so the cursor is dropped.  Returns the number removed. */                \
+    static size_t prefix##_internal_remove_indexed(Name *list, type const value)             \
+    {                                                                                        \
+        /* A value the index does not hold leaves the list untouched. */                     \
+        size_t const count = hooks##_INDEX_COUNT(list, value);                               \
+        if (count == 0) { return 0; }                                                        \
+                                                                                             \
+        list->cursor->node = NULL;                                                           \
+                                                                                             \
+        /* Unlinking a node also removes it from the index, so keep taking */                \
+        /* any remaining node of the value until there are none. */                          \
+        Name##Node *match = NULL;                                                            \
+        while ((match = hooks##_INDEX_ANY(list, value)))                                     \
+        {                                                                                    \
+            prefix##_internal_unlink_node(list, match);                                      \
+        }                                                                                    \
+                                                                                             \
+        return count;                                                                        \
+    }                                                                                        \
+                                                                                             \
+    /* Removes every node whose element satisfies the predicate in a */                      \
+    /* single pass.  Returns the number of nodes removed. */                                 \
+    static size_t prefix##_internal_remove_matching(Name *list,                              \
+                                                    Name##Predicate const predicate,         \
+                                                    void *context)                           \
+    {                                                                                        \
+        hooks##_TRAVERSED(list, list->size);                                                 \
+                                                                                             \
+        size_t const originalSize = list->size;                                              \
+        Name##Node *node = list->head;                                                       \
+        size_t index = 0;                                                                    \
+                                                                                             \
+        while (node)                                                                         \
+        {                                                                                    \
+            /* Read the next node before this one may be released. */                        \
+            Name##Node *next = node->next;                                                   \
+                                                                                             \
+            /* A removed node hands its index to the next one, so the */                     \
+            /* index only advances past nodes which stay. */                                 \
+            if (predicate(node->data, context))                                              \
+            {                                                                                \
+                prefix##_internal_remove_node(list, node, index);                            \
+            }                                                                                \
+            else                                                                             \
+            {                                                                                \
+                ++index;                                                                     \
+            }                                                                                \
+                                                                                             \
+            node = next;                                                                     \
+        }                                                                                    \
+                                                                                             \
+        return originalSize - list->size;                                                    \
+    }                                                                                        \
+                                                                                             \
+    /* Takes `count` nodes stored next to each other from the pool, stores */                \
+    /* `values` in them, and links them to each other.  The first node's */                  \
+    /* `previous` and the last node's `next` are null, left for the caller */                \
+    /* to connect.  Aborts if allocation fails. */                                           \
+    static Name##Node *prefix##_internal_allocate_block(Name *list, type const *values,      \
+                                                        size_t const count)                  \
+    {                                                                                        \
+        Name##Node *block = (Name##Node *)node_pool_acquire_block(list->pool, count);        \
+        if (!block) { prefix##_internal_bad_alloc(); }                                       \
+                                                                                             \
+        hooks##_COUNT(list, nodesAcquired, count);                                           \
+                                                                                             \
+        /* Each node links to its neighbors within the block. */                             \
+        for (size_t i = 0; i < count; ++i)                                                   \
+        {                                                                                    \
+            block[i].data = values[i];                                                       \
+            block[i].previous = i > 0 ? &block[i - 1] : NULL;                                \
+            block[i].next = i + 1 < count ? &block[i + 1] : NULL;                            \
+            hooks##_RECORD(list, &block[i]);                                                 \
+        }                                                                                    \
+                                                                                             \
+        return block;                                                                        \
+    }                                                                                        \
+                                                                                             \
+    /* Appends `count` values to the end of the list as one block. */                        \
+    static void prefix##_internal_append_values(Name *list, type const *values,              \
+                                                size_t const count)                          \
+    {                                                                                        \
+        if (count == 0) { return; }                                                          \
+                                                                                             \
+        Name##Node *block = prefix##_internal_allocate_block(list, values, count);           \
+                                                                                             \
+        /* Connect the block after the tail, or make it the whole list.  A */                \
+        /* block which does not directly follow the tail in memory counts */                 \
+        /* as one scattered node. */                                                         \
+        block[0].previous = list->tail;                                                      \
+        if (list->tail)                                                                      \
+        {                                                                                    \
+            if (block != list->tail + 1) { ++list->scatteredNodes; }                         \
+            list->tail->next = &block[0];                                                    \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            list->head = &block[0];                                                          \
+        }                                                                                    \
+                                                                                             \
+        list->tail = &block[count - 1];                                                      \
+        list->size += count;                                                                 \
+        hooks##_CHANGED(list);                                                               \
+    }                                                                                        \
+                                                                                             \
+    /* Prepends `count` values to the front of the list as one block, */                     \
+    /* keeping their order, so values[0] becomes the first element. */                       \
+    static void prefix##_internal_prepend_values(Name *list, type const *values,             \
+                                                 size_t const count)                         \
+    {                                                                                        \
+        if (count == 0) { return; }                                                          \
+                                                                                             \
+        Name##Node *block = prefix##_internal_allocate_block(list, values, count);           \
+                                                                                             \
+        /* Connect the block before the head, or make it the whole list. */                  \
+        block[count - 1].next = list->head;                                                  \
+        if (list->head)                                                                      \
+        {                                                                                    \
+            if (&block[count] != list->head) { ++list->scatteredNodes; }                     \
+            list->head->previous = &block[count - 1];                                        \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            list->tail = &block[count - 1];                                                  \
+        }                                                                                    \
+                                                                                             \
+        list->head = &block[0];                                                              \
+        list->size += count;                                                                 \
+        hooks##_CHANGED(list);                                                               \
+                                                                                             \
+        /* Every existing node, the cursor's included, moved up by `count`. */               \
+        if (list->cursor->node) { list->cursor->index += count; }                            \
+    }
+
+// Defines the internal functions which sort the list and keep it sorted.
+#define GENERIC_LIST_DEFINE_ORDERING(Name, prefix, type, traits, hooks)                      \
+                                                                                             \
+    /* Detaches the run of non-decreasing elements starting at `*rest`, */                   \
+    /* storing its last node in `*last`.  Returns its first node. */                         \
+    static Name##Node *prefix##_internal_take_run(Name##Node **rest, Name##Node **last)      \
+    {                                                                                        \
+        Name##Node *first = *rest;                                                           \
+        Name##Node *node = first;                                                            \
+                                                                                             \
+        /* Extend the run while the next element is not smaller. */                          \
+        while (node->next && !traits##_LESS(&node->next->data, &node->data))                 \
+        {                                                                                    \
+            node = node->next;                                                               \
+        }                                                                                    \
+                                                                                             \
+        /* Cut the run off from the nodes after it. */                                       \
+        *rest = node->next;                                                                  \
+        node->next = NULL;                                                                   \
+        *last = node;                                                                        \
+        return first;                                                                        \
+    }                                                                                        \
+                                                                                             \
+    /* Merges two runs linked through their `next` pointers.  The left run */                \
+    /* came first, so ties are taken from it, which keeps the sort stable. */                \
+    static Name##Node *prefix##_internal_merge_runs(Name##Node *left, Name##Node *right)     \
+    {                                                                                        \
+        /* `link` points to the pointer the next node taken is stored in. */                 \
+        Name##Node *first = NULL;                                                            \
+        Name##Node **link = &first;                                                          \
+                                                                                             \
+        /* Take the smaller front node of the two runs until one is empty. */                \
+        while (left && right)                                                                \
+        {                                                                                    \
+            if (traits##_LESS(&right->data, &left->data))                                    \
+            {                                                                                \
+                *link = right;                                                               \
+                link = &right->next;                                                         \
+                right = right->next;                                                         \
+            }                                                                                \
+            else                                                                             \
+            {                                                                                \
+                *link = left;                                                                \
+                link = &left->next;                                                          \
+                left = left->next;                                                           \
+            }                                                                                \
+        }                                                                                    \
+                                                                                             \
+        /* The rest of the other run follows as it is. */                                    \
+        *link = left ? left : right;                                                         \
+        return first;                                                                        \
+    }                                                                                        \
+                                                                                             \
+    /* Sorts the list by relinking its nodes with a bottom-up merge sort of */               \
+    /* the runs already in the list, see sort().  Bin `i` holds */                           \
+    /* a merge of 2^i runs, so each new run is merged upward like a carry. */                \
+    static void prefix##_internal_sort_nodes(Name *list)                                     \
+    {                                                                                        \
+        /* A list of fewer than two elements is already sorted. */                           \
+        if (list->size < 2) { return; }                                                      \
+                                                                                             \
+        hooks##_CHANGED(list);                                                               \
+                                                                                             \
+        /* Sort through the `next` pointers alone, the `previous` pointers */                \
+        /* are restored once at the end. */                                                  \
+        Name##Node *bins[GENERIC_LIST_SORT_BIN_COUNT] = { NULL };                            \
+        Name##Node *rest = list->head;                                                       \
+                                                                                             \
+        while (rest)                                                                         \
+        {                                                                                    \
+            Name##Node *last = NULL;                                                         \
+            Name##Node *carry = prefix##_internal_take_run(&rest, &last);                    \
+                                                                                             \
+            /* Merge the run into the full bins below the first empty one. */                \
+            /* The last bin absorbs everything, which only a list of more */                 \
+            /* than 2^63 runs could reach. */                                                \
+            size_t bin = 0;                                                                  \
+            while (bin + 1 < GENERIC_LIST_SORT_BIN_COUNT && bins[bin])                       \
+            {                                                                                \
+                carry = prefix##_internal_merge_runs(bins[bin], carry);                      \
+                bins[bin] = NULL;                                                            \
+                ++bin;                                                                       \
+            }                                                                                \
+                                                                                             \
+            bins[bin] = carry;                                                               \
+        }                                                                                    \
+                                                                                             \
+        /* Merge the bins, earlier nodes from higher bins to the left. */                    \
+        Name##Node *head = NULL;                                                             \
+        for (size_t bin = 0; bin < GENERIC_LIST_SORT_BIN_COUNT; ++bin)                       \
+        {                                                                                    \
+            if (bins[bin])                                                                   \
+            {                                                                                \
+                head = head ? prefix##_internal_merge_runs(bins[bin], head) : bins[bin];     \
+            }                                                                                \
+        }                                                                                    \
+                                                                                             \
+        /* Restore the `previous` pointers and the tail, counting the nodes */               \
+        /* which no longer follow their predecessor in memory. */                            \
+        Name##Node *previous = NULL;                                                         \
+        list->scatteredNodes = 0;                                                            \
+        for (Name##Node *node = head; node; node = node->next)                               \
+        {                                                                                    \
+            if (previous && node != previous + 1) { ++list->scatteredNodes; }                \
+            node->previous = previous;                                                       \
+            previous = node;                                                                 \
+        }                                                                                    \
+                                                                                             \
+        hooks##_TRAVERSED(list, list->size);                                                 \
+        list->head = head;                                                                   \
+        list->tail = previous;                                                               \
+                                                                                             \
+        /* The cursor's node has moved to an unknown index. */                               \
+        list->cursor->node = NULL;                                                           \
+    }                                                                                        \
+                                                                                             \
+    /* Inserts a node storing `value` into a sorted list, after every node */                \
+    /* storing a smaller or equal element, searching from the cursor or the */               \
+    /* tail.  The cursor is left on the new node. */                                         \
+    static void prefix##_internal_insert_sorted(Name *list, type const value)                \
+    {                                                                                        \
+        Name##Node *after = NULL;                                                            \
+        size_t index = 0;                                                                    \
+                                                                                             \
+        /* An element no smaller than the tail goes at the end, the */                       \
+        /* common case of sorted input. */                                                   \
+        if (!list->tail || !traits##_LESS(&value, &list->tail->data))                        \
+        {                                                                                    \
+            index = list->size;                                                              \
+        }                                                                                    \
+        /* An element smaller than the head goes at the front. */                            \
+        else if (traits##_LESS(&value, &list->head->data))                                   \
+        {                                                                                    \
+            after = list->head;                                                              \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            /* The walk stops at the head at the latest, which does not */                   \
+            /* store a larger element. */                                                    \
+            Name##Node *node = list->cursor->node ? list->cursor->node : list->tail;         \
+            size_t position = list->cursor->node ? list->cursor->index : list->size - 1;     \
+            size_t const start = position;                                                   \
+                                                                                             \
+            /* Walk back past larger elements, then forward past smaller */                  \
+            /* or equal ones, ending on the node to insert after. */                         \
+            while (traits##_LESS(&value, &node->data))                                       \
+            {                                                                                \
+                node = node->previous;                                                       \
+                --position;                                                                  \
+            }                                                                                \
+            while (!traits##_LESS(&value, &node->next->data))                                \
+            {                                                                                \
+                node = node->next;                                                           \
+                ++position;                                                                  \
+            }                                                                                \
+                                                                                             \
+            hooks##_TRAVERSED(list, position > start ? position - start : start - position); \
+            after = node->next;                                                              \
+            index = position + 1;                                                            \
+        }                                                                                    \
+                                                                                             \
+        /* Link a new node between `before` and `after`. */                                  \
+        Name##Node *node = prefix##_internal_allocate_node(list);                            \
+        Name##Node *before = after ? after->previous : list->tail;                           \
+        node->data = value;                                                                  \
+        node->previous = before;                                                             \
+        node->next = after;                                                                  \
+                                                                                             \
+        if (before)                                                                          \
+        {                                                                                    \
+            before->next = node;                                                             \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            list->head = node;                                                               \
+        }                                                                                    \
+                                                                                             \
+        if (after)                                                                           \
+        {                                                                                    \
+            after->previous = node;                                                          \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            list->tail = node;                                                               \
+        }                                                                                    \
+                                                                                             \
+        /* A node away from its predecessor in memory is scattered. */                       \
+        if (before && node != before + 1) { ++list->scatteredNodes; }                        \
+                                                                                             \
+        hooks##_RECORD(list, node);                                                          \
+        ++list->size;                                                                        \
+        hooks##_CHANGED(list);                                                               \
+                                                                                             \
+        /* Leave the cursor on the new node, so that the next insertion of */                \
+        /* a nearby element walks only a few nodes. */                                       \
+        list->cursor->node = node;                                                           \
+        list->cursor->index = index;                                                         \
+    }                                                                                        \
+                                                                                             \
+    /* Hash set of the elements passed to remove_values(), an open */                        \
+    /* addressing table with linear probing which is filled once and then */                 \
+    /* only queried. */                                                                      \
+    typedef struct Name##ValueSet                                                            \
+    {                                                                                        \
+        type *values;                                                                        \
+        bool *occupied;                                                                      \
+        size_t capacity;                                                                     \
+    } Name##ValueSet;                                                                        \
+                                                                                             \
+    /* Maps an element to its preferred slot of the set. */                                  \
+    static size_t prefix##_internal_home_slot(Name##ValueSet const *set, type const *value)  \
+    {                                                                                        \
+        return (size_t)traits##_HASH(value) & (set->capacity - 1);                           \
+    }                                                                                        \
+                                                                                             \
+    /* Fills a set with the `count` elements of an array, which may contain */               \
+    /* duplicates.  The table is kept at most a quarter full so that lookups */              \
+    /* of elements which are not in the set, the common case, stop quickly. */               \
+    /* Aborts if allocation fails. */                                                        \
+    static void prefix##_internal_fill_set(Name##ValueSet *set, type const *values,          \
+                                           size_t const count)                               \
+    {                                                                                        \
+        /* Choose the smallest power of two with room for four times the */                  \
+        /* elements. */                                                                      \
+        set->capacity = 8;                                                                   \
+        while (set->capacity < count * 4) { set->capacity *= 2; }                            \
+                                                                                             \
+        set->values = (type *)malloc(set->capacity * sizeof(type));                          \
+        set->occupied = (bool *)calloc(set->capacity, sizeof(bool));                         \
+        if (!set->values || !set->occupied) { prefix##_internal_bad_alloc(); }               \
+                                                                                             \
+        /* Insert each element at the first free slot of its probe run, */                   \
+        /* unless an earlier copy of it is already there. */                                 \
+        size_t const mask = set->capacity - 1;                                               \
+        for (size_t i = 0; i < count; ++i)                                                   \
+        {                                                                                    \
+            size_t position = prefix##_internal_home_slot(set, &values[i]);                  \
+            while (set->occupied[position] &&                                                \
+                   !traits##_EQUAL(&set->values[position], &values[i]))                      \
+            {                                                                                \
+                position = (position + 1) & mask;                                            \
+            }                                                                                \
+                                                                                             \
+            set->values[position] = values[i];                                               \
+            set->occupied[position] = true;                                                  \
+        }                                                                                    \
+    }                                                                                        \
+                                                                                             \
+    /* Predicate matching the elements held by a set. */                                     \
+    static bool prefix##_internal_in_set(type const value, void *context)                    \
+    {                                                                                        \
+        Name##ValueSet const *set = (Name##ValueSet const *)context;                         \
+        size_t const mask = set->capacity - 1;                                               \
+        size_t position = prefix##_internal_home_slot(set, &value);                          \
+                                                                                             \
+        /* Probe forward until the element or an empty slot is found. */                     \
+        while (set->occupied[position])                                                      \
+        {                                                                                    \
+            if (traits##_EQUAL(&set->values[position], &value)) { return true; }             \
+            position = (position + 1) & mask;                                                \
+        }                                                                                    \
+                                                                                             \
+        return false;                                                                        \
+    }
+
+// Defines the internal functions which move nodes between lists and between
+// a list and text.
+#define GENERIC_LIST_DEFINE_TRANSFER(Name, prefix, type, traits, hooks)                      \
+                                                                                             \
+    /* Makes both lists allocate from the same pool, merging a pool used by */               \
+    /* no other list into the other pool.  Returns false if both pools are */                \
+    /* also used by further lists, in which case nodes have to be copied. */                 \
+    static bool prefix##_internal_share_pool(Name *destination, Name *source)                \
+    {                                                                                        \
+        /* Lists which already share a pool have nothing to do. */                           \
+        if (destination->pool == source->pool) { return true; }                              \
+                                                                                             \
+        /* A pool only the source uses moves its slabs into the other. */                    \
+        if (source->pool->references == 1)                                                   \
+        {                                                                                    \
+            node_pool_absorb(destination->pool, source->pool);                               \
+            source->pool = destination->pool;                                                \
+            node_pool_retain(destination->pool);                                             \
+            return true;                                                                     \
+        }                                                                                    \
+                                                                                             \
+        /* Otherwise a pool only the destination uses moves instead. */                      \
+        if (destination->pool->references == 1)                                              \
+        {                                                                                    \
+            node_pool_absorb(source->pool, destination->pool);                               \
+            destination->pool = source->pool;                                                \
+            node_pool_retain(source->pool);                                                  \
+            return true;                                                                     \
+        }                                                                                    \
+                                                                                             \
+        return false;                                                                        \
+    }                                                                                        \
+                                                                                             \
+    /* Moves `count` nodes, starting at index `first` of `source`, in front */               \
+    /* of index `position` of `destination`, relinking them whenever the */                  \
+    /* lists can share a pool.  The lists must differ, and the indices and */                \
+    /* count must be within the bounds of their lists. */                                    \
+    static void prefix##_internal_splice(Name *destination, size_t const position,           \
+                                         Name *source, size_t const first,                   \
+                                         size_t const count)                                 \
+    {                                                                                        \
+        /* Moving nothing leaves both lists untouched. */                                    \
+        if (count == 0) { return; }                                                          \
+                                                                                             \
+        /* Find both ends of the range, and the destination node it is */                    \
+        /* inserted in front of, null to append it. */                                       \
+        Name##Node *firstNode = prefix##_internal_locate(source, first);                     \
+        Name##Node *lastNode = prefix##_internal_locate(source, first + count - 1);          \
+        Name##Node *after = position < destination->size                                     \
+                          ? prefix##_internal_locate(destination, position)                  \
+                          : NULL;                                                            \
+                                                                                             \
+        /* The source forgets the range, which is only walked if needed. */                  \
+        if (hooks##_TRACKED(source))                                                         \
+        {                                                                                    \
+            Name##Node const *node = firstNode;                                              \
+            for (size_t i = 0; i < count; ++i, node = node->next)                            \
+            {                                                                                \
+                hooks##_FORGET(source, node);                                                \
+            }                                                                                \
+            hooks##_TRAVERSED(source, count);                                                \
+        }                                                                                    \
+                                                                                             \
+        /* Detach the range from the source, joining the nodes around it. */                 \
+        if (firstNode->previous)                                                             \
+        {                                                                                    \
+            firstNode->previous->next = lastNode->next;                                      \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            source->head = lastNode->next;                                                   \
+        }                                                                                    \
+                                                                                             \
+        if (lastNode->next)                                                                  \
+        {                                                                                    \
+            lastNode->next->previous = firstNode->previous;                                  \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            source->tail = firstNode->previous;                                              \
+        }                                                                                    \
+                                                                                             \
+        /* Joining the nodes around the range leaves a hole in memory. */                    \
+        if (firstNode->previous && lastNode->next) { ++source->scatteredNodes; }             \
+        source->size -= count;                                                               \
+        hooks##_CHANGED(source);                                                             \
+                                                                                             \
+        /* A source cursor after the range moves down, one inside is dropped. */             \
+        if (source->cursor->node && source->cursor->index >= first)                          \
+        {                                                                                    \
+            if (source->cursor->index >= first + count)                                      \
+            {                                                                                \
+                source->cursor->index -= count;                                              \
+            }                                                                                \
+            else                                                                             \
+            {                                                                                \
+                source->cursor->node = NULL;                                                 \
+            }                                                                                \
+        }                                                                                    \
+                                                                                             \
+        /* Without a shared pool, replace the range with a copy in the */                    \
+        /* destination's pool, returning the originals to the source's pool. */              \
+        if (!prefix##_internal_share_pool(destination, source))                              \
+        {                                                                                    \
+            Name##Node *node = firstNode;                                                    \
+            Name##Node *copy = NULL;                                                         \
+            for (size_t i = 0; i < count; ++i)                                               \
+            {                                                                                \
+                /* Read the next original before this one is released. */                    \
+                Name##Node *next = node->next;                                               \
+                Name##Node *previous = copy;                                                 \
+                                                                                             \
+                /* Link a copy of the node after the previous copy. */                       \
+                copy = prefix##_internal_allocate_node(destination);                         \
+                copy->data = node->data;                                                     \
+                copy->previous = previous;                                                   \
+                copy->next = NULL;                                                           \
+                                                                                             \
+                if (previous)                                                                \
+                {                                                                            \
+                    previous->next = copy;                                                   \
+                }                                                                            \
+                else                                                                         \
+                {                                                                            \
+                    firstNode = copy;                                                        \
+                }                                                                            \
+                                                                                             \
+                prefix##_internal_free_node(source, node);                                   \
+                node = next;                                                                 \
+            }                                                                                \
+                                                                                             \
+            lastNode = copy;                                                                 \
+        }                                                                                    \
+                                                                                             \
+        /* Insert the range in front of `after`, or at the end. */                           \
+        Name##Node *before = after ? after->previous : destination->tail;                    \
+        firstNode->previous = before;                                                        \
+        lastNode->next = after;                                                              \
+                                                                                             \
+        if (before)                                                                          \
+        {                                                                                    \
+            before->next = firstNode;                                                        \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            destination->head = firstNode;                                                   \
+        }                                                                                    \
+                                                                                             \
+        if (after)                                                                           \
+        {                                                                                    \
+            after->previous = lastNode;                                                      \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            destination->tail = lastNode;                                                    \
+        }                                                                                    \
+                                                                                             \
+        /* Each join with a node outside the range is a jump in memory. */                   \
+        if (before) { ++destination->scatteredNodes; }                                       \
+        if (after) { ++destination->scatteredNodes; }                                        \
+        destination->size += count;                                                          \
+        hooks##_CHANGED(destination);                                                        \
+                                                                                             \
+        /* The destination records the range. */                                             \
+        if (hooks##_TRACKED(destination))                                                    \
+        {                                                                                    \
+            Name##Node *node = firstNode;                                                    \
+            for (size_t i = 0; i < count; ++i, node = node->next)                            \
+            {                                                                                \
+                hooks##_RECORD(destination, node);                                           \
+            }                                                                                \
+            hooks##_TRAVERSED(destination, count);                                           \
+        }                                                                                    \
+                                                                                             \
+        /* A destination cursor at or after the insertion point moves up. */                 \
+        if (destination->cursor->node && destination->cursor->index >= position)             \
+        {                                                                                    \
+            destination->cursor->index += count;                                             \
+        }                                                                                    \
+                                                                                             \
+        /* A sorted destination merges the range into place. */                              \
+        if (destination->sortedMode) { prefix##_internal_sort_nodes(destination); }          \
+                                                                                             \
+        /* Compact either list if automatic compaction is due. */                            \
+        prefix##_internal_auto_compact(source);                                              \
+        prefix##_internal_auto_compact(destination);                                         \
+    }                                                                                        \
+                                                                                             \
+    /* Writes the size of the list followed by at most `count` elements */                   \
+    /* starting at index `first`, marking elements left out before or after */               \
+    /* them with an ellipsis.  Returns false if writing to the stream failed. */             \
+    static bool prefix##_internal_write_list(Name const *list, FILE *stream,                 \
+                                             size_t const first, size_t count)               \
+    {                                                                                        \
+        /* Format into a buffer, written to the stream in large chunks. */                   \
+        OutputBuffer buffer;                                                                 \
+        if (!output_buffer_open(&buffer, stream)) { prefix##_internal_bad_alloc(); }         \
+                                                                                             \
+        /* Clamp the range to the elements the list actually holds. */                       \
+        size_t const start = first < list->size ? first : list->size;                        \
+        if (count > list->size - start) { count = list->size - start; }                      \
+                                                                                             \
+        /* The mark before the range counts as an element, so a comma follows. */            \
+        output_buffer_begin_list(&buffer, list->size);                                       \
+        if (start > 0)                                                                       \
+        {                                                                                    \
+            output_buffer_append_text(&buffer, " ...");                                      \
+            buffer.elementCount = 1;                                                         \
+        }                                                                                    \
+                                                                                             \
+        /* Find the first node of the range, then format each element. */                    \
+        Name##Node const *node = start < list->size                                          \
+                               ? prefix##_internal_locate(list, start)                       \
+                               : NULL;                                                       \
+                                                                                             \
+        hooks##_TRAVERSED(list, count);                                                      \
+        for (size_t written = 0; written < count; ++written)                                 \
+        {                                                                                    \
+            output_buffer_begin_element(&buffer);                                            \
+            traits##_FORMAT(&buffer, &node->data);                                           \
+            node = node->next;                                                               \
+        }                                                                                    \
+                                                                                             \
+        /* Mark the elements left out after the range. */                                    \
+        if (start + count < list->size)                                                      \
+        {                                                                                    \
+            output_buffer_append_text(&buffer, buffer.elementCount > 0 ? ", ..." : " ...");  \
+        }                                                                                    \
+        output_buffer_end_list(&buffer);                                                     \
+                                                                                             \
+        /* Flush the rest, reporting any write which failed on the way. */                   \
+        return output_buffer_close(&buffer);                                                 \
+    }                                                                                        \
+                                                                                             \
+    /* Appends every element a scanner reads to the list in batches.  Counts */              \
+    /* the elements in `valuesRead`, and returns the status that stopped the */              \
+    /* scanner. */                                                                           \
+    static TextScanStatus prefix##_internal_append_scanned(Name *list, TextScanner *scanner, \
+                                                           size_t *valuesRead)               \
+    {                                                                                        \
+        /* Collect elements on the stack, so that each batch is appended */                  \
+        /* as a single block of nodes. */                                                    \
+        type batch[GENERIC_LIST_BATCH_LENGTH(type)];                                         \
+        size_t batchCount = 0;                                                               \
+        TextScanStatus status;                                                               \
+                                                                                             \
+        while ((status = traits##_PARSE(scanner, &batch[batchCount])) == TEXT_SCAN_VALUE)    \
+        {                                                                                    \
+            if (++batchCount == GENERIC_LIST_BATCH_LENGTH(type))                             \
+            {                                                                                \
+                prefix##_internal_append_values(list, batch, batchCount);                    \
+                *valuesRead += batchCount;                                                   \
+                batchCount = 0;                                                              \
+            }                                                                                \
+        }                                                                                    \
+                                                                                             \
+        /* Append the last, partial batch. */                                                \
+        prefix##_internal_append_values(list, batch, batchCount);                            \
+        *valuesRead += batchCount;                                                           \
+        return status;                                                                       \
+    }                                                                                        \
+                                                                                             \
+    /* Range of a file parsed by one thread of the parallel loader, holding */               \
+    /* its text, the private list and scanner it is parsed with, the number */               \
+    /* of elements read, the status that ended it, and its thread. */                        \
+    typedef struct Name##LoadRange                                                           \
+    {                                                                                        \
+        char const *text;                                                                    \
+        size_t length;                                                                       \
+        Name list;                                                                           \
+        TextScanner scanner;                                                                 \
+        size_t valuesRead;                                                                   \
+        TextScanStatus status;                                                               \
+        PlatformThread thread;                                                               \
+        bool threaded;                                                                       \
+    } Name##LoadRange;                                                                       \
+                                                                                             \
+    /* Parses one range of the parallel loader, run on a thread of its own. */               \
+    static void prefix##_internal_load_range(void *argument)                                 \
+    {                                                                                        \
+        Name##LoadRange *range = (Name##LoadRange *)argument;                                \
+                                                                                             \
+        text_scanner_initialize(&range->scanner, range->text, range->length);                \
+        range->status = prefix##_internal_append_scanned(&range->list, &range->scanner,      \
+                                                         &range->valuesRead);                \
+    }
+
+// Defines the functions which create, load, compact, and release a list.
+#define GENERIC_LIST_DEFINE_LIFETIME(Name, prefix, type, traits, hooks)                      \
+                                                                                             \
+    /* Initializes an empty list.  Returns false if allocation fails. */                     \
+    bool prefix##_initialize(Name *list)                                                     \
+    {                                                                                        \
+        /* The list starts empty, with compaction on request only and in */                  \
+        /* insertion order. */                                                               \
+        list->head = NULL;                                                                   \
+        list->tail = NULL;                                                                   \
+        list->size = 0;                                                                      \
+        list->autoCompact = false;                                                           \
+        list->scatteredNodes = 0;                                                            \
+        list->sortedMode = false;                                                            \
+                                                                                             \
+        /* The cursor starts on no node. */                                                  \
+        list->cursor = (Name##Cursor *)malloc(sizeof(Name##Cursor));                         \
+        if (!list->cursor) { return false; }                                                 \
+        list->cursor->node = NULL;                                                           \
+        list->cursor->index = 0;                                                             \
+                                                                                             \
+        /* Let the hooks prepare the members they add to the handle. */                      \
+        if (!hooks##_INITIALIZE(list))                                                       \
+        {                                                                                    \
+            free(list->cursor);                                                              \
+            list->cursor = NULL;                                                             \
+            return false;                                                                    \
+        }                                                                                    \
+                                                                                             \
+        /* Create the pool last, undoing the rest if that fails. */                          \
+        list->pool = prefix##_internal_create_pool(list);                                    \
+        if (!list->pool)                                                                     \
+        {                                                                                    \
+            hooks##_CLEANUP(list);                                                           \
+            free(list->cursor);                                                              \
+            list->cursor = NULL;                                                             \
+            return false;                                                                    \
+        }                                                                                    \
+                                                                                             \
+        return true;                                                                         \
+    }                                                                                        \
+                                                                                             \
+    /* Appends the elements of a file to the list, reporting any problem */                  \
+    /* as a diagnostic message. */                                                           \
+    void prefix##_load_data_from_file(Name *list, char const *fileName)                      \
+    {                                                                                        \
+        /* A name too short to end in .txt cannot name a text file. */                       \
+        if (!fileName || strlen(fileName) < GENERIC_LIST_MINIMUM_NAME_LENGTH)                \
+        {                                                                                    \
+            fprintf(stderr, "ERROR: Please provide the name of a text (.txt) file.\n");      \
+            return;                                                                          \
+        }                                                                                    \
+                                                                                             \
+        LinkedListLoadReport report;                                                         \
+        if (prefix##_load_data_with_report(list, fileName, &report)) { return; }             \
+                                                                                             \
+        /* Point at the invalid text, or report that the file did not open. */               \
+        if (report.parseError)                                                               \
+        {                                                                                    \
+            fprintf(stderr, "ERROR: Invalid element at line %zu, column %zu of %s, "         \
+                            "%zu values were read.\n",                                       \
+                    report.errorLine, report.errorColumn, fileName, report.valuesRead);      \
+            return;                                                                          \
+        }                                                                                    \
+                                                                                             \
+        fprintf(stderr, "ERROR: Unable to open %s file.\n", fileName);                       \
+    }                                                                                        \
+                                                                                             \
+    /* Appends the whitespace separated elements of a file to the list, */                   \
+    /* parsing the mapped file in place.  Returns false if the file cannot */                \
+    /* be opened, or if invalid text is found, in which case the elements */                 \
+    /* before it have been appended and the report holds its position. */                    \
+    bool prefix##_load_data_with_report(Name *list, char const *fileName,                    \
+                                        LinkedListLoadReport *report)                        \
+    {                                                                                        \
+        /* Start from a report of nothing read and no error. */                              \
+        report->valuesRead = 0;                                                              \
+        report->parseError = false;                                                          \
+        report->errorOffset = 0;                                                             \
+        report->errorLine = 0;                                                               \
+        report->errorColumn = 0;                                                             \
+                                                                                             \
+        hooks##_BEGIN(list);                                                                 \
+                                                                                             \
+        /* Map the file, leaving the list untouched if it cannot be read. */                 \
+        MappedFile mapping;                                                                  \
+        if (!fileName || !file_mapping_open(&mapping, fileName))                             \
+        {                                                                                    \
+            hooks##_END(list, LOAD);                                                         \
+            return false;                                                                    \
+        }                                                                                    \
+                                                                                             \
+        /* Parse the mapped text in place, appending in batches. */                          \
+        TextScanner scanner;                                                                 \
+        text_scanner_initialize(&scanner, mapping.data, mapping.length);                     \
+        TextScanStatus const status = prefix##_internal_append_scanned(list, &scanner,       \
+                                                                       &report->valuesRead); \
+                                                                                             \
+        /* A sorted list merges the appended elements into place. */                         \
+        if (list->sortedMode) { prefix##_internal_sort_nodes(list); }                        \
+                                                                                             \
+        /* Report where the invalid text starts, if that stopped the scan. */                \
+        if (status == TEXT_SCAN_ERROR)                                                       \
+        {                                                                                    \
+            report->parseError = true;                                                       \
+            report->errorOffset = scanner.errorOffset;                                       \
+            report->errorLine = scanner.errorLine;                                           \
+            report->errorColumn = scanner.errorColumn;                                       \
+        }                                                                                    \
+                                                                                             \
+        file_mapping_close(&mapping);                                                        \
+        prefix##_internal_auto_compact(list);                                                \
+                                                                                             \
+        hooks##_END(list, LOAD);                                                             \
+        return !report->parseError;                                                          \
+    }                                                                                        \
+                                                                                             \
+    /* Appends the elements of a file to the list like load_data_with_report() */            \
+    /* on up to `threadCount` threads, one per processor if zero.  Each thread */            \
+    /* parses a range of lines into a private list, and the private lists are */             \
+    /* then concatenated in file order. */                                                   \
+    bool prefix##_load_data_parallel(Name *list, char const *fileName,                       \
+                                     size_t const threadCount,                               \
+                                     LinkedListLoadReport *report)                           \
+    {                                                                                        \
+        /* Start from a report of nothing read and no error. */                              \
+        report->valuesRead = 0;                                                              \
+        report->parseError = false;                                                          \
+        report->errorOffset = 0;                                                             \
+        report->errorLine = 0;                                                               \
+        report->errorColumn = 0;                                                             \
+                                                                                             \
+        hooks##_BEGIN(list);                                                                 \
+                                                                                             \
+        /* Map the file, leaving the list untouched if it cannot be read. */                 \
+        MappedFile mapping;                                                                  \
+        if (!fileName || !file_mapping_open(&mapping, fileName))                             \
+        {                                                                                    \
+            hooks##_END(list, LOAD);                                                         \
+            return false;                                                                    \
+        }                                                                                    \
+                                                                                             \
+        /* Give each thread enough text to outweigh starting it, within */                   \
+        /* the limit on threads, and always use at least one range. */                       \
+        size_t rangeCount = threadCount ? threadCount : platform_processor_count();          \
+        size_t const largest = mapping.length / GENERIC_LIST_PARALLEL_LOAD_MINIMUM_BYTES;    \
+                                                                                             \
+        if (rangeCount > largest) { rangeCount = largest; }                                  \
+        if (rangeCount > GENERIC_LIST_PARALLEL_LOAD_MAXIMUM_THREADS)                         \
+        {                                                                                    \
+            rangeCount = GENERIC_LIST_PARALLEL_LOAD_MAXIMUM_THREADS;                         \
+        }                                                                                    \
+        if (rangeCount == 0) { rangeCount = 1; }                                             \
+                                                                                             \
+        Name##LoadRange *ranges = (Name##LoadRange *)malloc(rangeCount *                     \
+                                                            sizeof(Name##LoadRange));        \
+        if (!ranges) { prefix##_internal_bad_alloc(); }                                      \
+                                                                                             \
+        /* Move every split forward to the start of the following line. */                   \
+        size_t start = 0;                                                                    \
+        for (size_t i = 0; i < rangeCount; ++i)                                              \
+        {                                                                                    \
+            size_t end = mapping.length;                                                     \
+                                                                                             \
+            if (i + 1 < rangeCount)                                                          \
+            {                                                                                \
+                end = mapping.length / rangeCount * (i + 1);                                 \
+                if (end < start) { end = start; }                                            \
+                                                                                             \
+                char const *newline = end < mapping.length                                   \
+                    ? (char const *)memchr(mapping.data + end, '\n', mapping.length - end)   \
+                    : NULL;                                                                  \
+                end = newline ? (size_t)(newline - mapping.data) + 1 : mapping.length;       \
+            }                                                                                \
+                                                                                             \
+            /* Each range parses into a private list, which needs no lock. */                \
+            Name##LoadRange *range = &ranges[i];                                             \
+            range->text = mapping.data + start;                                              \
+            range->length = end - start;                                                     \
+            range->valuesRead = 0;                                                           \
+            range->status = TEXT_SCAN_END;                                                   \
+            range->threaded = false;                                                         \
+                                                                                             \
+            if (!prefix##_initialize(&range->list)) { prefix##_internal_bad_alloc(); }       \
+                                                                                             \
+            start = end;                                                                     \
+        }                                                                                    \
+                                                                                             \
+        /* Start a thread for every range but the first, which this */                       \
+        /* thread parses itself. */                                                          \
+        for (size_t i = 1; i < rangeCount; ++i)                                              \
+        {                                                                                    \
+            ranges[i].threaded = platform_thread_start(&ranges[i].thread,                    \
+                                                       prefix##_internal_load_range,         \
+                                                       &ranges[i]);                          \
+        }                                                                                    \
+                                                                                             \
+        prefix##_internal_load_range(&ranges[0]);                                            \
+                                                                                             \
+        /* Wait for each thread, parsing any range whose thread could not */                 \
+        /* be started here instead. */                                                       \
+        for (size_t i = 1; i < rangeCount; ++i)                                              \
+        {                                                                                    \
+            if (ranges[i].threaded)                                                          \
+            {                                                                                \
+                platform_thread_join(&ranges[i].thread);                                     \
+            }                                                                                \
+            else                                                                             \
+            {                                                                                \
+                prefix##_internal_load_range(&ranges[i]);                                    \
+            }                                                                                \
+        }                                                                                    \
+                                                                                             \
+        /* Gather the private lists in file order, stopping after the first */               \
+        /* range with invalid text, whose line counts from the ranges before. */             \
+        size_t linesBefore = 0;                                                              \
+        for (size_t i = 0; i < rangeCount; ++i)                                              \
+        {                                                                                    \
+            Name##LoadRange *range = &ranges[i];                                             \
+                                                                                             \
+            if (i > 0) { prefix##_concat(&ranges[0].list, &range->list); }                   \
+            report->valuesRead += range->valuesRead;                                         \
+                                                                                             \
+            if (range->status == TEXT_SCAN_ERROR)                                            \
+            {                                                                                \
+                report->parseError = true;                                                   \
+                report->errorOffset = (size_t)(range->text - mapping.data) +                 \
+                                      range->scanner.errorOffset;                            \
+                report->errorLine = linesBefore + range->scanner.errorLine;                  \
+                report->errorColumn = range->scanner.errorColumn;                            \
+                break;                                                                       \
+            }                                                                                \
+                                                                                             \
+            linesBefore += range->scanner.line - 1;                                          \
+        }                                                                                    \
+                                                                                             \
+        /* Move the gathered elements to the list, then release the private */               \
+        /* lists, including any left out after invalid text. */                              \
+        prefix##_concat(list, &ranges[0].list);                                              \
+                                                                                             \
+        for (size_t i = 0; i < rangeCount; ++i) { prefix##_cleanup(&ranges[i].list); }       \
+                                                                                             \
+        free(ranges);                                                                        \
+        file_mapping_close(&mapping);                                                        \
+                                                                                             \
+        hooks##_END(list, LOAD);                                                             \
+        return !report->parseError;                                                          \
+    }                                                                                        \
+                                                                                             \
+    /* Releases every node along with the pool, unless the pool is shared. */                \
+    /* The list must be initialized again before reuse. */                                   \
+    void prefix##_cleanup(Name *list)                                                        \
+    {                                                                                        \
+        /* Release the pool before the hooks, which may count in it. */                      \
+        prefix##_internal_release_pool(list);                                                \
+        hooks##_CLEANUP(list);                                                               \
+                                                                                             \
+        /* Leave the handle empty and pointing to nothing. */                                \
+        list->size = 0;                                                                      \
+        list->head = NULL;                                                                   \
+        list->tail = NULL;                                                                   \
+        free(list->cursor);                                                                  \
+        list->cursor = NULL;                                                                 \
+        list->scatteredNodes = 0;                                                            \
+    }                                                                                        \
+                                                                                             \
+    /* Returns memory held by the pool and unused by any node to the system. */              \
+    void prefix##_trim(Name *list)                                                           \
+    {                                                                                        \
+        node_pool_trim(list->pool);                                                          \
+    }                                                                                        \
+                                                                                             \
+    /* Moves every node into a single block of a new pool, in list order. */                 \
+    void prefix##_compact(Name *list)                                                        \
+    {                                                                                        \
+        hooks##_BEGIN(list);                                                                 \
+                                                                                             \
+        /* An empty list only returns its slabs. */                                          \
+        if (list->size == 0)                                                                 \
+        {                                                                                    \
+            prefix##_clear(list);                                                            \
+            prefix##_trim(list);                                                             \
+            hooks##_END(list, COMPACT);                                                      \
+            return;                                                                          \
+        }                                                                                    \
+                                                                                             \
+        /* Take a single block for every node from a new pool. */                            \
+        NodePool *pool = prefix##_internal_create_pool(list);                                \
+        if (!pool) { prefix##_internal_bad_alloc(); }                                        \
+                                                                                             \
+        Name##Node *block = (Name##Node *)node_pool_acquire_block(pool, list->size);         \
+        if (!block) { prefix##_internal_bad_alloc(); }                                       \
+                                                                                             \
+        /* Copy the elements in list order, linking each node to its */                      \
+        /* neighbors in the block. */                                                        \
+        size_t index = 0;                                                                    \
+        for (Name##Node const *node = list->head; node; node = node->next, ++index)          \
+        {                                                                                    \
+            block[index].data = node->data;                                                  \
+            block[index].previous = index > 0 ? &block[index - 1] : NULL;                    \
+            block[index].next = index + 1 < list->size ? &block[index + 1] : NULL;           \
+        }                                                                                    \
+                                                                                             \
+        /* Release the old nodes, and switch the list to the block. */                       \
+        prefix##_internal_release_pool(list);                                                \
+        list->pool = pool;                                                                   \
+        list->head = &block[0];                                                              \
+        list->tail = &block[list->size - 1];                                                 \
+                                                                                             \
+        /* The cursor keeps its index, now a direct offset in the block. */                  \
+        if (list->cursor->node) { list->cursor->node = &block[list->cursor->index]; }        \
+                                                                                             \
+        /* Every node now directly follows its predecessor, and has moved. */                \
+        list->scatteredNodes = 0;                                                            \
+        hooks##_RELOCATED(list);                                                             \
+        hooks##_CHANGED(list);                                                               \
+                                                                                             \
+        hooks##_TRAVERSED(list, list->size);                                                 \
+        hooks##_COUNT(list, nodesReleased, list->size);                                      \
+        hooks##_COUNT(list, nodesAcquired, list->size);                                      \
+        hooks##_END(list, COMPACT);                                                          \
+    }                                                                                        \
+                                                                                             \
+    /* Enables or disables automatic compaction. */                                          \
+    void prefix##_set_auto_compact(Name *list, bool const enabled)                           \
+    {                                                                                        \
+        /* Compact right away if the list is already scattered enough. */                    \
+        list->autoCompact = enabled;                                                         \
+        prefix##_internal_auto_compact(list);                                                \
+    }
+
+// Defines the functions which add, remove, move, and reorder elements.
+#define GENERIC_LIST_DEFINE_MODIFIERS(Name, prefix, type, traits, hooks)                     \
+                                                                                             \
+    /* Removes every element by rewinding the pool, keeping its slabs, or */                 \
+    /* returning the nodes one by one to a pool shared with other lists. */                  \
+    void prefix##_clear(Name *list)                                                          \
+    {                                                                                        \
+        hooks##_BEGIN(list);                                                                 \
+        hooks##_COUNT(list, nodesReleased, list->size);                                      \
+                                                                                             \
+        /* Rewind a pool only this list uses, which returns every node at */                 \
+        /* once.  The other lists sharing a pool reuse the nodes instead. */                 \
+        if (list->pool->references == 1)                                                     \
+        {                                                                                    \
+            node_pool_reset(list->pool);                                                     \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            prefix##_internal_release_nodes(list);                                           \
+        }                                                                                    \
+                                                                                             \
+        hooks##_CLEAR(list);                                                                 \
+                                                                                             \
+        /* Reset the handle to an empty list. */                                             \
+        list->size = 0;                                                                      \
+        hooks##_CHANGED(list);                                                               \
+        list->head = NULL;                                                                   \
+        list->tail = NULL;                                                                   \
+        list->cursor->node = NULL;                                                           \
+        list->cursor->index = 0;                                                             \
+        list->scatteredNodes = 0;                                                            \
+                                                                                             \
+        hooks##_END(list, CLEAR);                                                            \
+    }                                                                                        \
+                                                                                             \
+    /* Appends an element to the end of the list, or inserts it in its */                    \
+    /* place in a sorted list. */                                                            \
+    void prefix##_push_back(Name *list, type const value)                                    \
+    {                                                                                        \
+        hooks##_BEGIN(list);                                                                 \
+                                                                                             \
+        if (list->sortedMode)                                                                \
+        {                                                                                    \
+            prefix##_internal_insert_sorted(list, value);                                    \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            Name##Node *node = prefix##_internal_allocate_node(list);                        \
+            node->next = NULL;                                                               \
+            node->data = value;                                                              \
+            node->previous = list->tail;                                                     \
+                                                                                             \
+            /* Link the node after the tail, or make it the only node.  A */                 \
+            /* node away from the tail in memory is scattered. */                            \
+            if (list->tail)                                                                  \
+            {                                                                                \
+                if (node != list->tail + 1) { ++list->scatteredNodes; }                      \
+                list->tail->next = node;                                                     \
+            }                                                                                \
+            else                                                                             \
+            {                                                                                \
+                list->head = node;                                                           \
+            }                                                                                \
+                                                                                             \
+            list->tail = node;                                                               \
+            hooks##_RECORD(list, node);                                                      \
+            ++list->size;                                                                    \
+            hooks##_CHANGED(list);                                                           \
+        }                                                                                    \
+                                                                                             \
+        prefix##_internal_auto_compact(list);                                                \
+        hooks##_END(list, PUSH_BACK);                                                        \
+    }                                                                                        \
+                                                                                             \
+    /* Inserts an element at the front of the list, or in its place in a */                  \
+    /* sorted list. */                                                                       \
+    void prefix##_push_front(Name *list, type const value)                                   \
+    {                                                                                        \
+        hooks##_BEGIN(list);                                                                 \
+                                                                                             \
+        if (list->sortedMode)                                                                \
+        {                                                                                    \
+            prefix##_internal_insert_sorted(list, value);                                    \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            Name##Node *node = prefix##_internal_allocate_node(list);                        \
+            node->previous = NULL;                                                           \
+            node->data = value;                                                              \
+            node->next = list->head;                                                         \
+                                                                                             \
+            /* Link the node before the head, or make it the only node.  A */                \
+            /* node away from the head in memory is scattered. */                            \
+            if (list->head)                                                                  \
+            {                                                                                \
+                if (node + 1 != list->head) { ++list->scatteredNodes; }                      \
+                list->head->previous = node;                                                 \
+            }                                                                                \
+            else                                                                             \
+            {                                                                                \
+                list->tail = node;                                                           \
+            }                                                                                \
+                                                                                             \
+            /* Every existing node, the cursor's included, moved up by one. */               \
+            list->head = node;                                                               \
+            if (list->cursor->node) { ++list->cursor->index; }                               \
+                                                                                             \
+            hooks##_RECORD(list, node);                                                      \
+            ++list->size;                                                                    \
+            hooks##_CHANGED(list);                                                           \
+        }                                                                                    \
+                                                                                             \
+        prefix##_internal_auto_compact(list);                                                \
+        hooks##_END(list, PUSH_FRONT);                                                       \
+    }                                                                                        \
+                                                                                             \
+    /* Appends `count` elements as one block of nodes linked in one pass. */                 \
+    void prefix##_push_back_array(Name *list, type const *values, size_t const count)        \
+    {                                                                                        \
+        hooks##_BEGIN(list);                                                                 \
+                                                                                             \
+        /* A sorted list sorts the new elements into place, which takes a */                 \
+        /* single merge when they are already sorted. */                                     \
+        prefix##_internal_append_values(list, values, count);                                \
+        if (list->sortedMode) { prefix##_internal_sort_nodes(list); }                        \
+        prefix##_internal_auto_compact(list);                                                \
+                                                                                             \
+        hooks##_END(list, PUSH_BACK_ARRAY);                                                  \
+    }                                                                                        \
+                                                                                             \
+    /* Inserts `count` elements at the front as one block, keeping their */                  \
+    /* order so that values[0] becomes the first element. */                                 \
+    void prefix##_push_front_array(Name *list, type const *values, size_t const count)       \
+    {                                                                                        \
+        hooks##_BEGIN(list);                                                                 \
+                                                                                             \
+        /* A sorted list sorts the new elements into place. */                               \
+        prefix##_internal_prepend_values(list, values, count);                               \
+        if (list->sortedMode) { prefix##_internal_sort_nodes(list); }                        \
+        prefix##_internal_auto_compact(list);                                                \
+                                                                                             \
+        hooks##_END(list, PUSH_FRONT_ARRAY);                                                 \
+    }                                                                                        \
+                                                                                             \
+    /* Removes the last element, if any. */                                                  \
+    void prefix##_pop_back(Name *list)                                                       \
+    {                                                                                        \
+        if (!list->tail) { return; }                                                         \
+                                                                                             \
+        hooks##_BEGIN(list);                                                                 \
+        prefix##_internal_remove_node(list, list->tail, list->size - 1);                     \
+        hooks##_END(list, POP_BACK);                                                         \
+    }                                                                                        \
+                                                                                             \
+    /* Removes the first element, if any. */                                                 \
+    void prefix##_pop_front(Name *list)                                                      \
+    {                                                                                        \
+        if (!list->head) { return; }                                                         \
+                                                                                             \
+        hooks##_BEGIN(list);                                                                 \
+        prefix##_internal_remove_node(list, list->head, 0);                                  \
+        hooks##_END(list, POP_FRONT);                                                        \
+    }                                                                                        \
+                                                                                             \
+    /* Removes the element at an index. */                                                   \
+    void prefix##_remove_at_index(Name *list, size_t const index)                            \
+    {                                                                                        \
+        if (index >= list->size) { prefix##_internal_out_of_bounds(list->size, index); }     \
+                                                                                             \
+        hooks##_BEGIN(list);                                                                 \
+                                                                                             \
+        /* Seeking leaves the cursor on the node, from where removing it moves */            \
+        /* the cursor to its neighbor, ready for the next nearby removal. */                 \
+        prefix##_internal_remove_node(list, prefix##_internal_seek(list, index), index);     \
+        prefix##_internal_auto_compact(list);                                                \
+                                                                                             \
+        hooks##_END(list, REMOVE_AT_INDEX);                                                  \
+    }                                                                                        \
+                                                                                             \
+    /* Removes every element equal to `value`, directly through the index */                 \
+    /* kept by the hooks if there is one, otherwise in a single pass. */                     \
+    void prefix##_remove_value(Name *list, type const value)                                 \
+    {                                                                                        \
+        hooks##_BEGIN(list);                                                                 \
+                                                                                             \
+        /* Let the hooks build an index they deferred until it is needed. */                 \
+        hooks##_PREPARE_INDEX(list);                                                         \
+                                                                                             \
+        if (hooks##_INDEXED(list))                                                           \
+        {                                                                                    \
+            prefix##_internal_remove_indexed(list, value);                                   \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            /* Without an index every node has to be compared. */                            \
+            hooks##_TRAVERSED(list, list->size);                                             \
+                                                                                             \
+            Name##Node *node = list->head;                                                   \
+            size_t index = 0;                                                                \
+                                                                                             \
+            while (node)                                                                     \
+            {                                                                                \
+                /* Read the next node before this one may be released. */                    \
+                Name##Node *next = node->next;                                               \
+                                                                                             \
+                /* A removed node hands its index to the next one. */                        \
+                if (traits##_EQUAL(&node->data, &value))                                     \
+                {                                                                            \
+                    prefix##_internal_remove_node(list, node, index);                        \
+                }                                                                            \
+                else                                                                         \
+                {                                                                            \
+                    ++index;                                                                 \
+                }                                                                            \
+                                                                                             \
+                node = next;                                                                 \
+            }                                                                                \
+        }                                                                                    \
+                                                                                             \
+        prefix##_internal_auto_compact(list);                                                \
+        hooks##_END(list, REMOVE_VALUE);                                                     \
+    }                                                                                        \
+                                                                                             \
+    /* Removes every element satisfying the predicate, called once per */                    \
+    /* element in order.  Returns the number of elements removed. */                         \
+    size_t prefix##_remove_if(Name *list, Name##Predicate const predicate, void *context)    \
+    {                                                                                        \
+        hooks##_BEGIN(list);                                                                 \
+                                                                                             \
+        size_t const removed = prefix##_internal_remove_matching(list, predicate, context);  \
+        prefix##_internal_auto_compact(list);                                                \
+                                                                                             \
+        hooks##_END(list, REMOVE_IF);                                                        \
+        return removed;                                                                      \
+    }                                                                                        \
+                                                                                             \
+    /* Removes every element equal to any of `count` values in a single */                   \
+    /* pass, looking each element up in a hash set of the values, or */                      \
+    /* directly through the index kept by the hooks if there is one. */                      \
+    /* Returns the number of elements removed. */                                            \
+    size_t prefix##_remove_values(Name *list, type const *values, size_t const count)        \
+    {                                                                                        \
+        if (count == 0) { return 0; }                                                        \
+                                                                                             \
+        hooks##_BEGIN(list);                                                                 \
+        hooks##_PREPARE_INDEX(list);                                                         \
+        size_t removed = 0;                                                                  \
+                                                                                             \
+        /* With an index only the matching nodes are visited. */                             \
+        if (hooks##_INDEXED(list))                                                           \
+        {                                                                                    \
+            for (size_t i = 0; i < count; ++i)                                               \
+            {                                                                                \
+                removed += prefix##_internal_remove_indexed(list, values[i]);                \
+            }                                                                                \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            /* Otherwise each node costs one lookup in a set of the values, */               \
+            /* rather than one comparison per value. */                                      \
+            Name##ValueSet set;                                                              \
+            prefix##_internal_fill_set(&set, values, count);                                 \
+                                                                                             \
+            removed = prefix##_internal_remove_matching(list, prefix##_internal_in_set,      \
+                                                        &set);                               \
+            free(set.values);                                                                \
+            free(set.occupied);                                                              \
+        }                                                                                    \
+                                                                                             \
+        prefix##_internal_auto_compact(list);                                                \
+                                                                                             \
+        hooks##_END(list, REMOVE_VALUES);                                                    \
+        return removed;                                                                      \
+    }                                                                                        \
+                                                                                             \
+    /* Moves `count` elements, starting at index `first` of `source`, in */                  \
+    /* front of index `position` of `destination`, which may equal its size */               \
+    /* to append.  The nodes are relinked rather than copied, so apart from */               \
+    /* finding the positions the cost does not depend on the number of */                    \
+    /* elements moved, with these exceptions: */                                             \
+    /* - The lists share their node pools from then on.  The first move */                   \
+    /*   between two lists with separate pools merges one pool into the */                   \
+    /*   other, which takes time proportional to its slabs and released */                   \
+    /*   nodes. */                                                                           \
+    /* - When both pools are already shared with further lists they cannot */                \
+    /*   be merged, and the elements are copied into the destination's pool. */              \
+    /* - The moved nodes are visited to update whatever the hooks keep for */                \
+    /*   either list, and a sorted destination is sorted again. */                           \
+    /* The lists must be different lists. */                                                 \
+    void prefix##_splice(Name *destination, size_t const position, Name *source,             \
+                         size_t const first, size_t const count)                             \
+    {                                                                                        \
+        if (destination == source) { prefix##_internal_same_list(); }                        \
+                                                                                             \
+        /* Check every index before either list is touched. */                               \
+        if (position > destination->size)                                                    \
+        {                                                                                    \
+            prefix##_internal_out_of_bounds(destination->size, position);                    \
+        }                                                                                    \
+        if (first > source->size) { prefix##_internal_out_of_bounds(source->size, first); }  \
+        if (count > source->size - first)                                                    \
+        {                                                                                    \
+            prefix##_internal_out_of_bounds(source->size, first + count - 1);                \
+        }                                                                                    \
+                                                                                             \
+        hooks##_BEGIN(destination);                                                          \
+        prefix##_internal_splice(destination, position, source, first, count);               \
+        hooks##_END(destination, SPLICE);                                                    \
+    }                                                                                        \
+                                                                                             \
+    /* Moves every element of `source` to the end of `destination`, leaving */               \
+    /* the source empty.  The nodes are relinked like splice(), so the cost */               \
+    /* does not depend on the length of either list, with the same */                        \
+    /* exceptions. */                                                                        \
+    void prefix##_concat(Name *destination, Name *source)                                    \
+    {                                                                                        \
+        if (destination == source) { prefix##_internal_same_list(); }                        \
+                                                                                             \
+        hooks##_BEGIN(destination);                                                          \
+        prefix##_internal_splice(destination, destination->size, source, 0, source->size);   \
+        hooks##_END(destination, SPLICE);                                                    \
+    }                                                                                        \
+                                                                                             \
+    /* Moves the element at an index and every element after it to the end */                \
+    /* of `tail`.  Only the split point has to be found, and the moved */                    \
+    /* elements are relinked like splice(), with the same exceptions. */                     \
+    void prefix##_split(Name *list, size_t const index, Name *tail)                          \
+    {                                                                                        \
+        if (list == tail) { prefix##_internal_same_list(); }                                 \
+        if (index > list->size) { prefix##_internal_out_of_bounds(list->size, index); }      \
+                                                                                             \
+        hooks##_BEGIN(list);                                                                 \
+        prefix##_internal_splice(tail, tail->size, list, index, list->size - index);         \
+        hooks##_END(list, SPLICE);                                                           \
+    }                                                                                        \
+                                                                                             \
+    /* Sorts the elements in ascending order, keeping equal elements in */                   \
+    /* their current order.  The nodes are relinked rather than copied, so */                \
+    /* no memory is allocated, and a list which is already sorted takes a */                 \
+    /* single pass.  Sorting random elements leaves neighboring nodes far */                 \
+    /* apart in memory, which automatic compaction repairs if enabled. */                    \
+    void prefix##_sort(Name *list)                                                           \
+    {                                                                                        \
+        hooks##_BEGIN(list);                                                                 \
+                                                                                             \
+        prefix##_internal_sort_nodes(list);                                                  \
+        prefix##_internal_auto_compact(list);                                                \
+                                                                                             \
+        hooks##_END(list, SORT);                                                             \
+    }                                                                                        \
+                                                                                             \
+    /* Enables or disables sorted mode.  Enabling it sorts the list, after */                \
+    /* which push_back() and push_front() insert each element in its place, */               \
+    /* bulk insertion and splicing merge the new elements in, and searches */                \
+    /* stop at the first larger element.  Disabling it keeps the order. */                   \
+    void prefix##_set_sorted(Name *list, bool const enabled)                                 \
+    {                                                                                        \
+        /* Only a list entering sorted mode has to be sorted. */                             \
+        if (enabled && !list->sortedMode) { prefix##_sort(list); }                           \
+        list->sortedMode = enabled;                                                          \
+    }
+
+// Defines the functions which read, search, and write the elements.
+#define GENERIC_LIST_DEFINE_ACCESS(Name, prefix, type, traits, hooks)                        \
+                                                                                             \
+    /* Returns the last element.  The list must not be empty. */                             \
+    type prefix##_back(Name const *list)                                                     \
+    {                                                                                        \
+        return list->tail->data;                                                             \
+    }                                                                                        \
+                                                                                             \
+    /* Returns the first element.  The list must not be empty. */                            \
+    type prefix##_front(Name const *list)                                                    \
+    {                                                                                        \
+        return list->head->data;                                                             \
+    }                                                                                        \
+                                                                                             \
+    /* Returns the element at an index.  The node is found from the head, */                 \
+    /* tail, or cursor, and the cursor is left on it, so sequential loops */                 \
+    /* over the indices advance one node per call.  Moving the cursor is a */                \
+    /* write, so threads reading one list at once must use iterators or */                   \
+    /* iterator_at() instead, which never change anything. */                                \
+    type prefix##_element_at(Name const *list, size_t const index)                           \
+    {                                                                                        \
+        if (index >= list->size) { prefix##_internal_out_of_bounds(list->size, index); }     \
+                                                                                             \
+        hooks##_BEGIN(list);                                                                 \
+        type const value = prefix##_internal_seek(list, index)->data;                        \
+        hooks##_END(list, ELEMENT_AT);                                                       \
+        return value;                                                                        \
+    }                                                                                        \
+                                                                                             \
+    /* Copies at most `capacity` elements into an array, in order.  Returns */               \
+    /* the number of elements copied. */                                                     \
+    size_t prefix##_export_array(Name const *list, type *values, size_t const capacity)      \
+    {                                                                                        \
+        hooks##_BEGIN(list);                                                                 \
+                                                                                             \
+        /* Stop at whichever of the list and the array ends first. */                        \
+        size_t copied = 0;                                                                   \
+        for (Name##Node const *node = list->head; node && copied < capacity;                 \
+             node = node->next)                                                              \
+        {                                                                                    \
+            values[copied++] = node->data;                                                   \
+        }                                                                                    \
+                                                                                             \
+        hooks##_TRAVERSED(list, copied);                                                     \
+        hooks##_END(list, EXPORT);                                                           \
+        return copied;                                                                       \
+    }                                                                                        \
+                                                                                             \
+    /* Returns an iterator on the first node, invalid if the list is empty. */               \
+    /* The index of an iterator is only accurate until the list changes. */                  \
+    Name##Iterator prefix##_iterator_first(Name const *list)                                 \
+    {                                                                                        \
+        Name##Iterator iterator = { list->head, 0 };                                         \
+        return iterator;                                                                     \
+    }                                                                                        \
+                                                                                             \
+    /* Returns an iterator on the last node, for scanning backward. */                       \
+    Name##Iterator prefix##_iterator_last(Name const *list)                                  \
+    {                                                                                        \
+        Name##Iterator iterator = { list->tail, list->size - 1 };                            \
+        return iterator;                                                                     \
+    }                                                                                        \
+                                                                                             \
+    /* Returns an iterator on the node at an index, found from whichever of */               \
+    /* the head, tail, or cursor is closest without moving the cursor. */                    \
+    Name##Iterator prefix##_iterator_at(Name const *list, size_t const index)                \
+    {                                                                                        \
+        if (index >= list->size) { prefix##_internal_out_of_bounds(list->size, index); }     \
+                                                                                             \
+        Name##Iterator iterator = { prefix##_internal_locate(list, index), index };          \
+        return iterator;                                                                     \
+    }                                                                                        \
+                                                                                             \
+    /* Returns true while the iterator is on a node of the list. */                          \
+    bool prefix##_iterator_valid(Name##Iterator const *iterator)                             \
+    {                                                                                        \
+        return iterator->node != NULL;                                                       \
+    }                                                                                        \
+                                                                                             \
+    /* Returns the element the iterator is on. */                                            \
+    type prefix##_iterator_value(Name##Iterator const *iterator)                             \
+    {                                                                                        \
+        return iterator->node->data;                                                         \
+    }                                                                                        \
+                                                                                             \
+    /* Returns a pointer to the element the iterator is on, in place. */                     \
+    type *prefix##_iterator_element(Name##Iterator const *iterator)                          \
+    {                                                                                        \
+        return &iterator->node->data;                                                        \
+    }                                                                                        \
+                                                                                             \
+    /* Moves the iterator to the following node. */                                          \
+    void prefix##_iterator_next(Name##Iterator *iterator)                                    \
+    {                                                                                        \
+        iterator->node = iterator->node->next;                                               \
+        ++iterator->index;                                                                   \
+    }                                                                                        \
+                                                                                             \
+    /* Moves the iterator to the preceding node. */                                          \
+    void prefix##_iterator_previous(Name##Iterator *iterator)                                \
+    {                                                                                        \
+        iterator->node = iterator->node->previous;                                           \
+        --iterator->index;                                                                   \
+    }                                                                                        \
+                                                                                             \
+    /* Writes the list to a file in the format of print_list(). */                           \
+    void prefix##_output_to_file(Name *list, char const *fileName)                           \
+    {                                                                                        \
+        /* Reject a missing name, or one too short to name a text file. */                   \
+        if (!fileName || strlen(fileName) < GENERIC_LIST_MINIMUM_NAME_LENGTH)                \
+        {                                                                                    \
+            fprintf(stderr, "ERROR: Please provide the name of a text (.txt) file.\n");      \
+            return;                                                                          \
+        }                                                                                    \
+                                                                                             \
+        FILE *file = fopen(fileName, "w");                                                   \
+        if (!file)                                                                           \
+        {                                                                                    \
+            fprintf(stderr, "ERROR: Unable to open %s file.\n", fileName);                   \
+            return;                                                                          \
+        }                                                                                    \
+                                                                                             \
+        hooks##_BEGIN(list);                                                                 \
+                                                                                             \
+        /* A write error, such as a full disk, only shows once the list has */               \
+        /* been written. */                                                                  \
+        if (!prefix##_internal_write_list(list, file, 0, list->size))                        \
+        {                                                                                    \
+            fprintf(stderr, "ERROR: Unable to write %s file.\n", fileName);                  \
+        }                                                                                    \
+                                                                                             \
+        fclose(file);                                                                        \
+        hooks##_END(list, OUTPUT);                                                           \
+    }                                                                                        \
+                                                                                             \
+    /* Returns the index of the first element equal to `value`, or the size */               \
+    /* of the list if there is none.  The index kept by the hooks, if there */               \
+    /* is one, reports an absent element without a walk, but only counts */                  \
+    /* the nodes of a stored one, so those are still found by walking from */                \
+    /* the head.  A sorted list stops at the first larger element. */                        \
+    static size_t prefix##_internal_find_first_index(Name const *list, type const value)     \
+    {                                                                                        \
+        /* An element the index does not hold is absent from the list. */                    \
+        if (hooks##_INDEXED(list) && hooks##_INDEX_COUNT(list, value) == 0)                  \
+        {                                                                                    \
+            return list->size;                                                               \
+        }                                                                                    \
+                                                                                             \
+        Name##Node const *node = list->head;                                                 \
+        size_t index = 0;                                                                    \
+                                                                                             \
+        while (node && !traits##_EQUAL(&node->data, &value))                                 \
+        {                                                                                    \
+            /* Every element after a larger one of a sorted list is larger. */               \
+            if (list->sortedMode && traits##_LESS(&value, &node->data))                      \
+            {                                                                                \
+                hooks##_TRAVERSED(list, index);                                              \
+                return list->size;                                                           \
+            }                                                                                \
+                                                                                             \
+            node = node->next;                                                               \
+            ++index;                                                                         \
+        }                                                                                    \
+                                                                                             \
+        hooks##_TRAVERSED(list, index);                                                      \
+        return index;                                                                        \
+    }                                                                                        \
+                                                                                             \
+    /* Returns the index of the first element equal to `value`, or the size */               \
+    /* of the list if there is none.  Finding a stored element walks from */                 \
+    /* the head to its first node, even with an index. */                                    \
+    size_t prefix##_find_first_index_containing(Name const *list, type const value)          \
+    {                                                                                        \
+        hooks##_BEGIN(list);                                                                 \
+        size_t const index = prefix##_internal_find_first_index(list, value);                \
+        hooks##_END(list, FIND);                                                             \
+        return index;                                                                        \
+    }                                                                                        \
+                                                                                             \
+    /* Returns true if any element is equal to `value`.  With the index */                   \
+    /* kept by the hooks this takes constant time, otherwise the list is */                  \
+    /* scanned. */                                                                           \
+    bool prefix##_contains(Name const *list, type const value)                               \
+    {                                                                                        \
+        hooks##_BEGIN(list);                                                                 \
+                                                                                             \
+        /* Counting the nodes of the value is enough, their positions are */                 \
+        /* not needed. */                                                                    \
+        bool const found = hooks##_INDEXED(list)                                             \
+                         ? hooks##_INDEX_COUNT(list, value) > 0                              \
+                         : prefix##_internal_find_first_index(list, value) != list->size;    \
+                                                                                             \
+        hooks##_END(list, CONTAINS);                                                         \
+        return found;                                                                        \
+    }                                                                                        \
+                                                                                             \
+    /* Prints the size of the list and every element to stdout. */                           \
+    void prefix##_print_list(Name const *list)                                               \
+    {                                                                                        \
+        hooks##_BEGIN(list);                                                                 \
+        prefix##_internal_write_list(list, stdout, 0, list->size);                           \
+        hooks##_END(list, PRINT);                                                            \
+    }                                                                                        \
+                                                                                             \
+    /* Prints the size of the list and at most `count` elements starting at */               \
+    /* index `first` to stdout, allowing huge lists to be displayed a page */                \
+    /* at a time.  Elements left out before or after the page are marked */                  \
+    /* with an ellipsis. */                                                                  \
+    void prefix##_print_list_page(Name const *list, size_t const first, size_t const count)  \
+    {                                                                                        \
+        hooks##_BEGIN(list);                                                                 \
+        prefix##_internal_write_list(list, stdout, first, count);                            \
+        hooks##_END(list, PRINT);                                                            \
+    }
+
+// End of header guard.
+#endif
@@ -0,0 +1,32 @@
+/*
+* File Name: int64_linked_list.c
+* Purpose: Contains the function definitions for a linked list of 64-bit
+*          integers, generated from generic_linked_list.h.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Include the header for the 64-bit integer list.
+#include "int64_linked_list.h"
+
+// Internal function that reads the next 64-bit integer from a scanner.
+static TextScanStatus internal_parse_int64(TextScanner *scanner, int64_t *value)
+{
+    long long parsed = 0;
+    TextScanStatus const status = text_scanner_next_long_long(scanner, &parsed);
+    *value = (int64_t)parsed;
+    return status;
+}
+
+// Defines the traits of the 64-bit integer list: values compare with == and
+// <, hash as integers, and are written and parsed as long long, which holds
+// every int64_t.
+#define INT64_LIST_EQUAL(a, b) LINKED_LIST_SCALAR_EQUAL(a, b)
+#define INT64_LIST_LESS(a, b) LINKED_LIST_SCALAR_LESS(a, b)
+#define INT64_LIST_HASH(value) LINKED_LIST_INTEGER_HASH(value)
+#define INT64_LIST_FORMAT(buffer, value) output_buffer_append_long_long((buffer), *(value))
+#define INT64_LIST_PARSE(scanner, value) internal_parse_int64((scanner), (value))
+
+// Defines the int64_list_*() functions.
+DEFINE_LINKED_LIST(Int64LinkedList, int64_list, int64_t, INT64_LIST)
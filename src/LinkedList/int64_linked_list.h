@@ -0,0 +1,25 @@
+/*
+* File Name: int64_linked_list.h
+* Purpose: Contains the types and function declarations for a linked list of
+*          64-bit integers, generated from generic_linked_list.h.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_INT64_LINKED_LIST_H
+#define BACHURSKI_INT64_LINKED_LIST_H
+
+// Include the generic list generator.
+#include "generic_linked_list.h"
+
+// Include required stdlib headers.
+#include <stdint.h>
+
+// Declares Int64LinkedList and the int64_list_*() functions, which are
+// described in generic_linked_list.h and mirror linked_list.h.
+DECLARE_LINKED_LIST(Int64LinkedList, int64_list, int64_t)
+
+// End of header guard.
+#endif
@@ -0,0 +1,315 @@
+/*
+* File Name: integer_stream.c
+* Purpose: Contains the function definitions for reading the integers of a
+*          text file as a stream.
+*
+*          The file is read into a fixed size buffer a chunk at a time, so a
+*          stream uses the same memory however large the file is.  A chunk
+*          usually ends partway through a token, so only the text up to the
+*          last whitespace of the chunk is scanned, and the partial token is
+*          moved to the front of the buffer to be completed by the next chunk.
+*          Errors are reported exactly as linked_list_load_data_with_report()
+*          reports them, with positions within the whole file.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Include the header for the integer stream.
+#include "integer_stream.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Defines the size of the buffer used when no chunk size is requested.
+#define DEFAULT_CHUNK_SIZE (64 * 1024)
+
+// Defines the smallest buffer a stream uses, which holds the longest
+// integer, "-2147483648", several times over.
+#define MINIMUM_CHUNK_SIZE 64
+
+// Defines the number of values filter_into_list() collects before appending
+// them to the list together.
+#define FILTER_BATCH_SIZE 256
+
+// Internal function that prints a diagnostic message and aborts the program if
+// a call to malloc returns a null pointer.
+static void internal_bad_alloc(void)
+{
+    fprintf(stderr, "Memory allocation failed!\n");
+    abort();
+}
+
+// Internal function that checks for the whitespace characters the scanner
+// accepts between integers.
+static bool internal_is_space(char const character)
+{
+    return character == ' ' || character == '\n' || character == '\t' ||
+           character == '\r' || character == '\v' || character == '\f';
+}
+
+// Internal function that records text which is not an integer.  `offset` is
+// the position of the text within the current chunk, and `lineStart` the
+// position within the file of the line it is on.
+static void internal_record_error(IntegerStream *stream, size_t const offset,
+                                  size_t const line, size_t const lineStart)
+{
+    stream->report.parseError = true;
+    stream->report.errorOffset = stream->chunkOffset + offset;
+    stream->report.errorLine = stream->lineCount + line;
+    stream->report.errorColumn = stream->report.errorOffset - lineStart + 1;
+}
+
+// Internal function that returns the position within the file of the line
+// the scanner is on.  Until the scanner passes a newline that line began in
+// an earlier chunk.
+static size_t internal_line_start(IntegerStream const *stream)
+{
+    TextScanner const *scanner = &stream->scanner;
+
+    if (scanner->line == 1) { return stream->lineOffset; }
+    return stream->chunkOffset + (size_t)(scanner->lineStart - scanner->begin);
+}
+
+// Internal function that moves on from the scanned chunk to the next one.
+// Returns false once the file is exhausted, or if reading fails.
+static bool internal_next_chunk(IntegerStream *stream)
+{
+    TextScanner *scanner = &stream->scanner;
+    size_t const scanned = (size_t)(scanner->end - scanner->begin);
+
+    if (stream->endOfFile) { return false; }
+
+    // Account for the lines of the scanned text, then move the partial token
+    // that followed it to the front of the buffer.
+    stream->lineOffset = internal_line_start(stream);
+    stream->lineCount += scanner->line - 1;
+    stream->chunkOffset += scanned;
+    stream->length -= scanned;
+    memmove(stream->buffer, stream->buffer + scanned, stream->length);
+
+    // Fill the rest of the buffer from the file.
+    size_t const wanted = stream->capacity - stream->length;
+    size_t const read = fread(stream->buffer + stream->length, 1, wanted, stream->file);
+    stream->length += read;
+
+    if (read < wanted)
+    {
+        stream->endOfFile = true;
+        stream->readError = ferror(stream->file) != 0;
+        if (stream->readError) { return false; }
+    }
+
+    // Scan the text up to the last whitespace, unless the end of the file
+    // completes the final token.
+    size_t complete = stream->length;
+    if (!stream->endOfFile)
+    {
+        while (complete > 0 && !internal_is_space(stream->buffer[complete - 1])) { --complete; }
+
+        // A full buffer without whitespace cannot be completed, which only a
+        // number padded with more zeros than the buffer holds can cause.
+        if (complete == 0)
+        {
+            text_scanner_initialize(scanner, stream->buffer, 0);
+            internal_record_error(stream, 0, 1, stream->lineOffset);
+            return false;
+        }
+    }
+
+    text_scanner_initialize(scanner, stream->buffer, complete);
+    return complete > 0;
+}
+
+// Opens a stream over the integers stored in a text file, which are read in
+// chunks of `chunkSize` bytes, or DEFAULT_CHUNK_SIZE bytes if `chunkSize` is
+// zero.  Returns false if the file cannot be opened.
+bool integer_stream_open(IntegerStream *stream, char const *fileName, size_t const chunkSize)
+{
+    stream->file = fileName ? fopen(fileName, "rb") : NULL;
+    if (!stream->file) { return false; }
+
+    stream->capacity = chunkSize ? chunkSize : DEFAULT_CHUNK_SIZE;
+    if (stream->capacity < MINIMUM_CHUNK_SIZE) { stream->capacity = MINIMUM_CHUNK_SIZE; }
+
+    stream->buffer = malloc(stream->capacity);
+    if (!stream->buffer) { internal_bad_alloc(); }
+
+    // Start with an empty chunk, the first read fills the buffer.
+    stream->length = 0;
+    stream->endOfFile = false;
+    stream->readError = false;
+    text_scanner_initialize(&stream->scanner, stream->buffer, 0);
+    stream->chunkOffset = 0;
+    stream->lineCount = 0;
+    stream->lineOffset = 0;
+
+    stream->report.valuesRead = 0;
+    stream->report.parseError = false;
+    stream->report.errorOffset = 0;
+    stream->report.errorLine = 0;
+    stream->report.errorColumn = 0;
+    return true;
+}
+
+// Closes the file and frees the buffer of a stream.
+void integer_stream_close(IntegerStream *stream)
+{
+    if (stream->file) { fclose(stream->file); }
+    free(stream->buffer);
+
+    stream->file = NULL;
+    stream->buffer = NULL;
+    stream->capacity = 0;
+    stream->length = 0;
+}
+
+// Reads the next integer of the stream into `value`.  Returns false once the
+// stream is exhausted, or stops at text which is not an integer, in which
+// case the report of the stream holds its position.
+bool integer_stream_next(IntegerStream *stream, int *value)
+{
+    if (stream->report.parseError) { return false; }
+
+    for (;;)
+    {
+        TextScanStatus const status = text_scanner_next(&stream->scanner, value);
+
+        if (status == TEXT_SCAN_VALUE)
+        {
+            ++stream->report.valuesRead;
+            return true;
+        }
+
+        if (status == TEXT_SCAN_ERROR)
+        {
+            TextScanner const *scanner = &stream->scanner;
+            internal_record_error(stream, scanner->errorOffset, scanner->errorLine,
+                                  internal_line_start(stream));
+            return false;
+        }
+
+        // The chunk is exhausted, continue with the next one.
+        if (!internal_next_chunk(stream)) { return false; }
+    }
+}
+
+// Reads up to `capacity` integers of the stream into `values`.  Returns the
+// number read, fewer than `capacity` only once the stream is exhausted or
+// stops at text which is not an integer.
+size_t integer_stream_read(IntegerStream *stream, int *values, size_t const capacity)
+{
+    size_t count = 0;
+
+    while (count < capacity && integer_stream_next(stream, &values[count])) { ++count; }
+
+    return count;
+}
+
+// Returns true if every integer of the file has been read, false if the
+// stream stopped at text which is not an integer, reading the file failed,
+// or values remain.
+bool integer_stream_completed(IntegerStream const *stream)
+{
+    return stream->endOfFile && !stream->readError && !stream->report.parseError &&
+           stream->scanner.cursor == stream->scanner.end;
+}
+
+// Returns the index within the file of the first of the remaining integers
+// of the stream that equals the desired value, otherwise
+// INTEGER_STREAM_NOT_FOUND is returned.  Reading stops at the match, so the
+// stream continues with the integer after it.
+size_t integer_stream_find_first_index_containing(IntegerStream *stream, int const value)
+{
+    int current;
+
+    while (integer_stream_next(stream, &current))
+    {
+        if (current == value) { return stream->report.valuesRead - 1; }
+    }
+
+    return INTEGER_STREAM_NOT_FOUND;
+}
+
+// Returns the number of remaining integers in the stream.
+size_t integer_stream_count(IntegerStream *stream)
+{
+    size_t const first = stream->report.valuesRead;
+    int current;
+
+    while (integer_stream_next(stream, &current)) {}
+
+    return stream->report.valuesRead - first;
+}
+
+// Returns the number of remaining integers in the stream for which the
+// predicate returns true.
+size_t integer_stream_count_if(IntegerStream *stream, LinkedListPredicate const predicate,
+                               void *context)
+{
+    size_t count = 0;
+    int current;
+
+    while (integer_stream_next(stream, &current))
+    {
+        if (predicate(current, context)) { ++count; }
+    }
+
+    return count;
+}
+
+// Stores the smallest and largest of the remaining integers in the stream in
+// `minimum` and `maximum`.  Returns false, leaving both unchanged, if no
+// integers remain.
+bool integer_stream_min_max(IntegerStream *stream, int *minimum, int *maximum)
+{
+    int current;
+
+    if (!integer_stream_next(stream, &current)) { return false; }
+
+    int smallest = current;
+    int largest = current;
+
+    while (integer_stream_next(stream, &current))
+    {
+        if (current < smallest) { smallest = current; }
+        if (current > largest) { largest = current; }
+    }
+
+    *minimum = smallest;
+    *maximum = largest;
+    return true;
+}
+
+// Appends the remaining integers in the stream for which the predicate
+// returns true to the list, in batches.  Returns the number appended.
+size_t integer_stream_filter_into_list(IntegerStream *stream, IntegerLinkedList *list,
+                                       LinkedListPredicate const predicate, void *context)
+{
+    int batch[FILTER_BATCH_SIZE];
+    size_t batchCount = 0;
+    size_t appended = 0;
+    int current;
+
+    while (integer_stream_next(stream, &current))
+    {
+        if (!predicate(current, context)) { continue; }
+
+        batch[batchCount] = current;
+
+        if (++batchCount == FILTER_BATCH_SIZE)
+        {
+            linked_list_push_back_array(list, batch, batchCount);
+            appended += batchCount;
+            batchCount = 0;
+        }
+    }
+
+    // Append whatever remains of the final batch.
+    linked_list_push_back_array(list, batch, batchCount);
+    return appended + batchCount;
+}
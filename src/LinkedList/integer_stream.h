@@ -0,0 +1,83 @@
+/*
+* File Name: integer_stream.h
+* Purpose: Contains the type and function declarations for reading the
+*          integers of a text file as a stream, a chunk at a time, so that
+*          values can be searched, counted and filtered without loading the
+*          whole file into a list.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_INTEGER_STREAM_H
+#define BACHURSKI_INTEGER_STREAM_H
+
+// Include the linked list header for the load report, predicate and list
+// types, and the header for the scanner that parses each chunk.
+#include "linked_list.h"
+#include "text_scanner.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Defines the index returned by integer_stream_find_first_index_containing()
+// when the value is not in the rest of the stream.
+#define INTEGER_STREAM_NOT_FOUND SIZE_MAX
+
+// Stream of the integers stored in a text file.
+// Contains:
+// - The open file.
+// - Buffer holding the current chunk of the file, and its capacity.
+// - Number of bytes in the buffer, of which the scanner covers the leading
+//   complete tokens while the rest waits for the next chunk.
+// - Whether the end of the file has been read into the buffer.
+// - Whether reading the file failed.
+// - Scanner over the complete tokens of the current chunk.
+// - Byte offset of the current chunk within the file.
+// - Number of lines, and byte offset of the line, the chunk starts in.
+// - Report of the values read so far and of any text which is not an integer.
+typedef struct IntegerStream
+{
+    FILE *file;
+    char *buffer;
+    size_t capacity;
+    size_t length;
+    bool endOfFile;
+    bool readError;
+    TextScanner scanner;
+    size_t chunkOffset;
+    size_t lineCount;
+    size_t lineOffset;
+    LinkedListLoadReport report;
+} IntegerStream;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying integer_stream.c file.
+    * Comments only serve to separate declarations by their general purpose.
+*/
+
+// Lifetime
+bool integer_stream_open(IntegerStream *stream, char const *fileName, size_t const chunkSize);
+void integer_stream_close(IntegerStream *stream);
+
+// Reading
+bool integer_stream_next(IntegerStream *stream, int *value);
+size_t integer_stream_read(IntegerStream *stream, int *values, size_t const capacity);
+bool integer_stream_completed(IntegerStream const *stream);
+
+// Queries
+size_t integer_stream_find_first_index_containing(IntegerStream *stream, int const value);
+size_t integer_stream_count(IntegerStream *stream);
+size_t integer_stream_count_if(IntegerStream *stream, LinkedListPredicate const predicate,
+                               void *context);
+bool integer_stream_min_max(IntegerStream *stream, int *minimum, int *maximum);
+size_t integer_stream_filter_into_list(IntegerStream *stream, IntegerLinkedList *list,
+                                       LinkedListPredicate const predicate, void *context);
+
+// End of header guard.
+#endif
@@ -0,0 +1,612 @@
+/*
+* File Name: journaled_linked_list.c
+* Purpose: Contains function definitions for the persistent variant of my
+*          linked list implementation.
+*
+*          The state of a journaled list is a checkpoint, the whole list saved
+*          in the binary format of linked_list_save_binary(), plus a journal of
+*          the changes made since.  Changes are buffered and appended to the
+*          journal in frames of `groupSize` changes, each frame written and
+*          synced to disk at once, so the cost of syncing is shared by the
+*          whole group.  Every frame carries a checksum, and a frame torn by a
+*          crash is dropped when the journal is replayed.
+*
+*          The journal header holds a copy of the header of the checkpoint it
+*          follows, which identifies the checkpoint by its element count and
+*          checksum.  A new checkpoint replaces the old one before a new
+*          journal replaces the old journal, so if a crash falls between the
+*          two, the old journal no longer matches the checkpoint and is
+*          discarded, its changes being part of the checkpoint already.
+*
+*          A frame that fails to be written may leave part of itself in the
+*          journal, and replay stops there, so nothing more is appended to a
+*          journal once a write fails.  The journal is marked broken instead,
+*          and every commit saves a checkpoint of the whole list, failing
+*          until one succeeds and starts a new journal.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Request the POSIX declarations, which strict ISO C builds hide.  This has to
+// come before the first header is included.
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+// Include the header for the journaled list.
+#include "journaled_linked_list.h"
+
+// Include the header for mapping the journal into memory for replay.
+#include "file_mapping.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include the platform headers which sync files to disk.
+// Conditional compilation for Windows environment.
+#if defined(_WIN32) || defined(_WIN64)
+#include <io.h>
+// Conditional compilation for Unix environment.
+#else
+#include <unistd.h>
+// End conditional compilation.
+#endif
+
+// Defines the magic bytes that start every journal and the version written.
+#define JOURNAL_MAGIC "CLLJRNL\n"
+#define JOURNAL_MAGIC_LENGTH 8
+#define JOURNAL_VERSION 1
+
+// Defines the number of leading bytes of the checkpoint copied into the
+// journal header, the header of the binary format, and the size of the
+// journal header: the magic, the version and header size as 32-bit integers,
+// then the copy of the checkpoint header.  All integers are little-endian.
+#define CHECKPOINT_TAG_SIZE 32
+#define JOURNAL_HEADER_SIZE (JOURNAL_MAGIC_LENGTH + 8 + CHECKPOINT_TAG_SIZE)
+
+// Defines the size of the header of a frame, the number of changes in the
+// frame and the checksum of those changes as 32-bit integers, and the size of
+// a change, the operation as one byte followed by its argument as a 64-bit
+// integer.
+#define FRAME_HEADER_SIZE 8
+#define RECORD_SIZE 9
+
+// Defines the number of changes in a frame, and the number of changes between
+// checkpoints, used when zero is requested.
+#define DEFAULT_GROUP_SIZE 256
+#define DEFAULT_CHECKPOINT_INTERVAL (1024 * 1024)
+
+// Defines the number of values pushed to the back that replay collects before
+// appending them to the list together.
+#define REPLAY_BATCH_SIZE 256
+
+// Defines the suffix of the temporary files that replace the checkpoint and
+// the journal.
+#define TEMPORARY_SUFFIX ".tmp"
+
+// Operations recorded in the journal.  The values are stored in the journal,
+// so they must not change.
+typedef enum JournalOperation
+{
+    JOURNAL_CLEAR = 1,
+    JOURNAL_PUSH_BACK = 2,
+    JOURNAL_PUSH_FRONT = 3,
+    JOURNAL_POP_BACK = 4,
+    JOURNAL_POP_FRONT = 5,
+    JOURNAL_REMOVE_AT_INDEX = 6,
+    JOURNAL_REMOVE_VALUE = 7
+} JournalOperation;
+
+// Internal function that prints a diagnostic message and aborts the program if
+// a call to malloc returns a null pointer.
+static void internal_bad_alloc(void)
+{
+    fprintf(stderr, "Memory allocation failed!\n");
+    abort();
+}
+
+// Internal functions that store and read integers in little-endian order.
+static void internal_store_u32(unsigned char *bytes, uint32_t const value)
+{
+    for (int i = 0; i < 4; ++i) { bytes[i] = (unsigned char)(value >> (8 * i)); }
+}
+
+static void internal_store_u64(unsigned char *bytes, uint64_t const value)
+{
+    for (int i = 0; i < 8; ++i) { bytes[i] = (unsigned char)(value >> (8 * i)); }
+}
+
+static uint32_t internal_read_u32(unsigned char const *bytes)
+{
+    uint32_t value = 0;
+    for (int i = 3; i >= 0; --i) { value = value << 8 | bytes[i]; }
+    return value;
+}
+
+static uint64_t internal_read_u64(unsigned char const *bytes)
+{
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; --i) { value = value << 8 | bytes[i]; }
+    return value;
+}
+
+// Internal function that returns the FNV-1a hash of the changes of a frame,
+// which detects a frame torn by a crash.
+static uint32_t internal_frame_checksum(unsigned char const *bytes, size_t const length)
+{
+    uint32_t hash = 2166136261u;
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Internal function that returns a copy of `name` followed by `suffix`.
+static char *internal_copy_name(char const *name, char const *suffix)
+{
+    size_t const nameLength = strlen(name);
+    size_t const suffixLength = strlen(suffix);
+    char *copy = malloc(nameLength + suffixLength + 1);
+
+    if (!copy) { internal_bad_alloc(); }
+
+    memcpy(copy, name, nameLength);
+    memcpy(copy + nameLength, suffix, suffixLength + 1);
+    return copy;
+}
+
+// Internal function that makes sure everything written to a file has reached
+// the disk.  Returns false if that fails.
+static bool internal_sync_file(FILE *file)
+{
+    if (fflush(file) != 0) { return false; }
+
+// Conditional compilation for Windows environment.
+#if defined(_WIN32) || defined(_WIN64)
+    return _commit(_fileno(file)) == 0;
+// Conditional compilation for Unix environment.
+#else
+    return fsync(fileno(file)) == 0;
+// End conditional compilation.
+#endif
+}
+
+// Internal function that syncs the file of the provided name to disk.
+static bool internal_sync_path(char const *fileName)
+{
+    FILE *file = fopen(fileName, "rb");
+    if (!file) { return false; }
+
+    bool const synced = internal_sync_file(file);
+    return fclose(file) == 0 && synced;
+}
+
+// Internal function that replaces the file `target` with the file `source`.
+static bool internal_replace_file(char const *source, char const *target)
+{
+// Conditional compilation for Windows environment, where a file cannot be
+// renamed over an existing one.
+#if defined(_WIN32) || defined(_WIN64)
+    remove(target);
+// End conditional compilation.
+#endif
+
+    return rename(source, target) == 0;
+}
+
+// Internal function that reads the header of the checkpoint into `tag`, or
+// fills `tag` with zeros if there is no checkpoint.
+static void internal_read_checkpoint_tag(JournaledIntegerList const *list,
+                                         unsigned char tag[CHECKPOINT_TAG_SIZE])
+{
+    memset(tag, 0, CHECKPOINT_TAG_SIZE);
+
+    FILE *file = fopen(list->checkpointName, "rb");
+    if (!file) { return; }
+
+    if (fread(tag, 1, CHECKPOINT_TAG_SIZE, file) != CHECKPOINT_TAG_SIZE)
+    {
+        memset(tag, 0, CHECKPOINT_TAG_SIZE);
+    }
+
+    fclose(file);
+}
+
+// Internal function that replaces the journal with an empty journal following
+// the current checkpoint, and opens it for appending.  Returns false if the
+// journal cannot be written.
+static bool internal_create_journal(JournaledIntegerList *list)
+{
+    unsigned char header[JOURNAL_HEADER_SIZE];
+    memcpy(header, JOURNAL_MAGIC, JOURNAL_MAGIC_LENGTH);
+    internal_store_u32(header + JOURNAL_MAGIC_LENGTH, JOURNAL_VERSION);
+    internal_store_u32(header + JOURNAL_MAGIC_LENGTH + 4, JOURNAL_HEADER_SIZE);
+    internal_read_checkpoint_tag(list, header + JOURNAL_MAGIC_LENGTH + 8);
+
+    if (list->journal)
+    {
+        fclose(list->journal);
+        list->journal = NULL;
+    }
+
+    // Write the new journal next to the old one, then replace it.
+    char *temporaryName = internal_copy_name(list->journalName, TEMPORARY_SUFFIX);
+    FILE *file = fopen(temporaryName, "wb");
+    bool written = file && fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+                   internal_sync_file(file);
+
+    if (file) { written = fclose(file) == 0 && written; }
+    written = written && internal_replace_file(temporaryName, list->journalName);
+    free(temporaryName);
+
+    if (written) { list->journal = fopen(list->journalName, "ab"); }
+    list->journaledCount = 0;
+    return list->journal != NULL;
+}
+
+// Internal function that writes the buffered changes to the journal as one
+// frame and syncs it to disk.  Returns false if the journal cannot be written,
+// marking it broken, as it may then end in part of the frame.
+static bool internal_write_frame(JournaledIntegerList *list)
+{
+    if (list->pendingCount == 0) { return true; }
+
+    size_t const length = FRAME_HEADER_SIZE + list->pendingCount * RECORD_SIZE;
+    unsigned char *frame = list->pending;
+    internal_store_u32(frame, (uint32_t)list->pendingCount);
+    internal_store_u32(frame + 4, internal_frame_checksum(frame + FRAME_HEADER_SIZE,
+                                                          length - FRAME_HEADER_SIZE));
+
+    bool const written = list->journal && fwrite(frame, 1, length, list->journal) == length &&
+                         internal_sync_file(list->journal);
+
+    // The changes of a failed frame are left to the checkpoint that repairs
+    // the journal, which saves them from the list.
+    if (written) { list->journaledCount += list->pendingCount; }
+    else { list->broken = true; }
+
+    list->pendingCount = 0;
+    return written;
+}
+
+// Internal function that buffers a change for the journal, writing the
+// buffered changes once a full group has been collected.  A broken journal
+// records nothing, but still commits once per group, retrying the checkpoint
+// that saves every change from the list.
+static void internal_journal(JournaledIntegerList *list, JournalOperation const operation,
+                             uint64_t const argument)
+{
+    if (!list->broken)
+    {
+        unsigned char *record = list->pending + FRAME_HEADER_SIZE +
+                                list->pendingCount * RECORD_SIZE;
+        record[0] = (unsigned char)operation;
+        internal_store_u64(record + 1, argument);
+    }
+
+    if (++list->pendingCount == list->groupSize && !journaled_list_commit(list))
+    {
+        fprintf(stderr, "ERROR: Unable to write to %s file.\n", list->journalName);
+    }
+}
+
+// Internal function that applies a change to the list.  Returns false if the
+// change is not valid for the list, which only a damaged journal can cause.
+static bool internal_apply(IntegerLinkedList *list, unsigned const operation,
+                           uint64_t const argument)
+{
+    int const value = (int)(uint32_t)argument;
+
+    switch (operation)
+    {
+    case JOURNAL_CLEAR: linked_list_clear(list); return true;
+    case JOURNAL_PUSH_BACK: linked_list_push_back(list, value); return true;
+    case JOURNAL_PUSH_FRONT: linked_list_push_front(list, value); return true;
+    case JOURNAL_POP_BACK: linked_list_pop_back(list); return true;
+    case JOURNAL_POP_FRONT: linked_list_pop_front(list); return true;
+    case JOURNAL_REMOVE_VALUE: linked_list_remove_value(list, value); return true;
+    case JOURNAL_REMOVE_AT_INDEX:
+        if (argument >= list->size) { return false; }
+        linked_list_remove_at_index(list, (size_t)argument);
+        return true;
+    default: return false;
+    }
+}
+
+// Internal function that replays the journal onto the list restored from the
+// checkpoint.  `current` is set to true if the journal exists, follows the
+// checkpoint, and ends with a complete frame, so it can be appended to.
+static LinkedListBinaryStatus internal_replay(JournaledIntegerList *list, bool *current)
+{
+    *current = false;
+
+    // Without a journal there is nothing to replay.
+    MappedFile mapping;
+    if (!file_mapping_open(&mapping, list->journalName)) { return LINKED_LIST_BINARY_OK; }
+
+    unsigned char const *bytes = (unsigned char const *)mapping.data;
+    unsigned char tag[CHECKPOINT_TAG_SIZE];
+    internal_read_checkpoint_tag(list, tag);
+
+    LinkedListBinaryStatus status = LINKED_LIST_BINARY_OK;
+
+    // Check the header, a journal following another checkpoint is ignored.
+    if (mapping.length < JOURNAL_HEADER_SIZE ||
+        memcmp(bytes, JOURNAL_MAGIC, JOURNAL_MAGIC_LENGTH) != 0)
+    {
+        status = LINKED_LIST_BINARY_NOT_BINARY_LIST;
+    }
+    else if (internal_read_u32(bytes + JOURNAL_MAGIC_LENGTH) != JOURNAL_VERSION)
+    {
+        status = LINKED_LIST_BINARY_UNSUPPORTED_VERSION;
+    }
+    else if (memcmp(bytes + JOURNAL_MAGIC_LENGTH + 8, tag, CHECKPOINT_TAG_SIZE) == 0)
+    {
+        int batch[REPLAY_BATCH_SIZE];
+        size_t batchCount = 0;
+        size_t offset = internal_read_u32(bytes + JOURNAL_MAGIC_LENGTH + 4);
+        if (offset > mapping.length) { offset = mapping.length; }
+
+        // Apply the frames in order, stopping at the first incomplete or
+        // damaged frame, which was being written when the program stopped.
+        while (mapping.length - offset >= FRAME_HEADER_SIZE)
+        {
+            size_t const count = internal_read_u32(bytes + offset);
+            unsigned char const *records = bytes + offset + FRAME_HEADER_SIZE;
+            size_t const available = mapping.length - offset - FRAME_HEADER_SIZE;
+
+            if (count > available / RECORD_SIZE ||
+                internal_frame_checksum(records, count * RECORD_SIZE) !=
+                    internal_read_u32(bytes + offset + 4))
+            {
+                break;
+            }
+
+            // Runs of values pushed to the back, the bulk of most journals,
+            // are appended as arrays.
+            for (size_t i = 0; i < count; ++i)
+            {
+                unsigned char const *record = records + i * RECORD_SIZE;
+                uint64_t const argument = internal_read_u64(record + 1);
+
+                if (record[0] == JOURNAL_PUSH_BACK)
+                {
+                    batch[batchCount] = (int)(uint32_t)argument;
+                    if (++batchCount == REPLAY_BATCH_SIZE)
+                    {
+                        linked_list_push_back_array(&list->list, batch, batchCount);
+                        batchCount = 0;
+                    }
+                    continue;
+                }
+
+                linked_list_push_back_array(&list->list, batch, batchCount);
+                batchCount = 0;
+
+                if (!internal_apply(&list->list, record[0], argument))
+                {
+                    status = LINKED_LIST_BINARY_CHECKSUM_MISMATCH;
+                    break;
+                }
+            }
+
+            if (status != LINKED_LIST_BINARY_OK) { break; }
+
+            offset += FRAME_HEADER_SIZE + count * RECORD_SIZE;
+            list->journaledCount += count;
+        }
+
+        // Append whatever remains of the final run.
+        linked_list_push_back_array(&list->list, batch, batchCount);
+        *current = offset == mapping.length;
+    }
+
+    file_mapping_close(&mapping);
+    return status;
+}
+
+// Opens a journaled list, restoring it from the checkpoint and journal of the
+// provided names, or starting an empty list if neither exists yet.  Changes
+// are written to the journal in groups of `groupSize`, and a checkpoint is
+// saved once `checkpointInterval` changes have been journaled, default values
+// being used for either if it is zero.  Returns LINKED_LIST_BINARY_OK if the
+// list is ready, otherwise the list is not opened and must not be used.
+LinkedListBinaryStatus journaled_list_open(JournaledIntegerList *list, char const *checkpointName,
+                                           char const *journalName, size_t const groupSize,
+                                           size_t const checkpointInterval)
+{
+    if (!checkpointName || !journalName || !linked_list_initialize(&list->list))
+    {
+        return LINKED_LIST_BINARY_OPEN_FAILED;
+    }
+
+    list->checkpointName = internal_copy_name(checkpointName, "");
+    list->journalName = internal_copy_name(journalName, "");
+    list->journal = NULL;
+    list->groupSize = groupSize ? groupSize : DEFAULT_GROUP_SIZE;
+    list->checkpointInterval = checkpointInterval ? checkpointInterval
+                                                  : DEFAULT_CHECKPOINT_INTERVAL;
+    list->pendingCount = 0;
+    list->journaledCount = 0;
+    list->broken = false;
+    list->pending = malloc(FRAME_HEADER_SIZE + list->groupSize * RECORD_SIZE);
+    if (!list->pending) { internal_bad_alloc(); }
+
+    // Restore the checkpoint, a missing checkpoint being an empty list.
+    LinkedListBinaryStatus status = linked_list_load_binary(&list->list, list->checkpointName);
+    if (status == LINKED_LIST_BINARY_OPEN_FAILED) { status = LINKED_LIST_BINARY_OK; }
+
+    // Then replay the changes made since.
+    bool current = false;
+    if (status == LINKED_LIST_BINARY_OK) { status = internal_replay(list, &current); }
+
+    // Continue the journal if it is intact.  A journal ending in a torn frame
+    // is settled with a new checkpoint, which also starts a new journal.
+    if (status == LINKED_LIST_BINARY_OK)
+    {
+        if (current)
+        {
+            list->journal = fopen(list->journalName, "ab");
+            if (!list->journal) { status = LINKED_LIST_BINARY_OPEN_FAILED; }
+        }
+        else if (list->journaledCount > 0)
+        {
+            status = journaled_list_checkpoint(list);
+        }
+        else if (!internal_create_journal(list))
+        {
+            status = LINKED_LIST_BINARY_WRITE_FAILED;
+        }
+    }
+
+    if (status != LINKED_LIST_BINARY_OK)
+    {
+        if (list->journal) { fclose(list->journal); }
+        free(list->checkpointName);
+        free(list->journalName);
+        free(list->pending);
+        linked_list_cleanup(&list->list);
+    }
+
+    return status;
+}
+
+// Writes any buffered changes to the journal, closes it, and frees the list.
+// Returns false if the buffered changes could not be written.
+bool journaled_list_close(JournaledIntegerList *list)
+{
+    bool closed = journaled_list_commit(list);
+
+    if (list->journal) { closed = fclose(list->journal) == 0 && closed; }
+
+    free(list->checkpointName);
+    free(list->journalName);
+    free(list->pending);
+    linked_list_cleanup(&list->list);
+
+    list->checkpointName = NULL;
+    list->journalName = NULL;
+    list->journal = NULL;
+    list->pending = NULL;
+    list->pendingCount = 0;
+    return closed;
+}
+
+// Writes the buffered changes to the journal and syncs them to disk, so they
+// survive a crash.  Saves a checkpoint once enough changes have been
+// journaled, or in place of a broken journal.  Returns false if the changes
+// could not be written, in which case every later commit saves a checkpoint
+// until one succeeds.
+bool journaled_list_commit(JournaledIntegerList *list)
+{
+    if (!list->broken) { internal_write_frame(list); }
+
+    // Fold the journal into a new checkpoint once it has grown long enough,
+    // and replace a journal that may end in part of a frame.
+    if (list->broken || list->journaledCount >= list->checkpointInterval)
+    {
+        return journaled_list_checkpoint(list) == LINKED_LIST_BINARY_OK;
+    }
+
+    return true;
+}
+
+// Saves the whole list as a new checkpoint and starts an empty journal, which
+// keeps restarts fast however many changes have been made, and repairs a
+// broken journal.  Returns LINKED_LIST_BINARY_OK if both were written.
+LinkedListBinaryStatus journaled_list_checkpoint(JournaledIntegerList *list)
+{
+    // Write the buffered changes first, so the old checkpoint and journal
+    // hold every change until the new checkpoint replaces them.  If that
+    // fails, or the journal is already broken, only the new checkpoint holds
+    // them, and the changes not journaled are no longer counted.
+    if (!list->broken) { internal_write_frame(list); }
+    list->pendingCount = 0;
+
+    // Save the checkpoint next to the old one, then replace it.
+    char *temporaryName = internal_copy_name(list->checkpointName, TEMPORARY_SUFFIX);
+    LinkedListBinaryStatus status = linked_list_save_binary(&list->list, temporaryName);
+
+    if (status == LINKED_LIST_BINARY_OK &&
+        (!internal_sync_path(temporaryName) ||
+         !internal_replace_file(temporaryName, list->checkpointName)))
+    {
+        status = LINKED_LIST_BINARY_WRITE_FAILED;
+    }
+
+    free(temporaryName);
+
+    // Start a journal following the new checkpoint, which repairs a broken
+    // journal.  Without one, the next commit saves a checkpoint again.
+    if (status == LINKED_LIST_BINARY_OK)
+    {
+        list->broken = !internal_create_journal(list);
+        if (list->broken) { status = LINKED_LIST_BINARY_WRITE_FAILED; }
+    }
+
+    return status;
+}
+
+// Removes every element from the list.
+void journaled_list_clear(JournaledIntegerList *list)
+{
+    linked_list_clear(&list->list);
+    internal_journal(list, JOURNAL_CLEAR, 0);
+}
+
+// Adds a node with the specified value to the back of the list.
+void journaled_list_push_back(JournaledIntegerList *list, int const value)
+{
+    linked_list_push_back(&list->list, value);
+    internal_journal(list, JOURNAL_PUSH_BACK, (uint32_t)value);
+}
+
+// Adds a node with the specified value to the front of the list.
+void journaled_list_push_front(JournaledIntegerList *list, int const value)
+{
+    linked_list_push_front(&list->list, value);
+    internal_journal(list, JOURNAL_PUSH_FRONT, (uint32_t)value);
+}
+
+// Removes the last node in the list, an empty list is left unchanged.
+void journaled_list_pop_back(JournaledIntegerList *list)
+{
+    if (list->list.size == 0) { return; }
+
+    linked_list_pop_back(&list->list);
+    internal_journal(list, JOURNAL_POP_BACK, 0);
+}
+
+// Removes the first node in the list, an empty list is left unchanged.
+void journaled_list_pop_front(JournaledIntegerList *list)
+{
+    if (list->list.size == 0) { return; }
+
+    linked_list_pop_front(&list->list);
+    internal_journal(list, JOURNAL_POP_FRONT, 0);
+}
+
+// Removes the node at the specified index, aborting like
+// linked_list_remove_at_index() if the index is out of range.
+void journaled_list_remove_at_index(JournaledIntegerList *list, size_t const index)
+{
+    linked_list_remove_at_index(&list->list, index);
+    internal_journal(list, JOURNAL_REMOVE_AT_INDEX, index);
+}
+
+// Removes all nodes from the list that contain the specified value.
+void journaled_list_remove_value(JournaledIntegerList *list, int const value)
+{
+    linked_list_remove_value(&list->list, value);
+    internal_journal(list, JOURNAL_REMOVE_VALUE, (uint32_t)value);
+}
@@ -0,0 +1,78 @@
+/*
+* File Name: journaled_linked_list.h
+* Purpose: Contains the structure definition and function declarations for
+*          the persistent variant of my linked list implementation, which logs
+*          every change to a journal and periodically saves a checkpoint, so
+*          that the list can be restored quickly after a restart.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_JOURNALED_LINKED_LIST_H
+#define BACHURSKI_JOURNALED_LINKED_LIST_H
+
+// Include the linked list header for the list and binary status types.
+#include "linked_list.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// Journaled List Handle
+// The list may be read through `list` with any linked_list_*() function, but
+// must only be changed through the journaled_list_*() functions, otherwise the
+// changes are lost on restart.
+// Contains:
+// - The list itself.
+// - Names of the checkpoint file and the journal file.
+// - The journal, open for appending.
+// - Buffer of changes not yet written to the journal, and their number.
+// - Number of changes written to the journal together, a group commit.
+// - Number of journaled changes after which a checkpoint is saved.
+// - Number of changes journaled since the last checkpoint.
+// - Whether a write to the journal failed, so a checkpoint must replace it.
+typedef struct JournaledIntegerList
+{
+    IntegerLinkedList list;
+    char *checkpointName;
+    char *journalName;
+    FILE *journal;
+    unsigned char *pending;
+    size_t pendingCount;
+    size_t groupSize;
+    size_t checkpointInterval;
+    size_t journaledCount;
+    bool broken;
+} JournaledIntegerList;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying journaled_linked_list.c
+    * file.  Comments only serve to separate declarations by their general
+    * purpose.
+*/
+
+// Lifetime
+LinkedListBinaryStatus journaled_list_open(JournaledIntegerList *list, char const *checkpointName,
+                                           char const *journalName, size_t const groupSize,
+                                           size_t const checkpointInterval);
+bool journaled_list_close(JournaledIntegerList *list);
+
+// Persistence
+bool journaled_list_commit(JournaledIntegerList *list);
+LinkedListBinaryStatus journaled_list_checkpoint(JournaledIntegerList *list);
+
+// Modifiers
+void journaled_list_clear(JournaledIntegerList *list);
+void journaled_list_push_back(JournaledIntegerList *list, int const value);
+void journaled_list_push_front(JournaledIntegerList *list, int const value);
+void journaled_list_pop_back(JournaledIntegerList *list);
+void journaled_list_pop_front(JournaledIntegerList *list);
+void journaled_list_remove_at_index(JournaledIntegerList *list, size_t const index);
+void journaled_list_remove_value(JournaledIntegerList *list, int const value);
+
+// End of header guard.
+#endif
@@ -3,6 +3,12 @@
 * Purpose: Contains constants, types, and function definitions for my
 *          linked list implementation.
 *
+*          IntegerLinkedList is generated by generic_linked_list.h, like any
+*          other list.  This file supplies the traits that compare, print,
+*          and parse its values, and the hooks that keep its value index,
+*          aggregates, parallel segments, and statistics up to date, then
+*          defines the functions only the integer list provides.
+*
 * Author: Austin Bachurski
 * Date: 08/25/2025
 */
@@ -10,19 +16,86 @@
 // Include the header for the linked list.
 #include "linked_list.h"
 
+// Include the private hash index of node values, and the aggregates kept of
+// the values.
+#include "value_aggregates.h"
+#include "value_index.h"
+
+// Include the private helpers used to read files.
+#include "file_mapping.h"
+
+// Include the private threads used to traverse lists in parallel.
+#include "platform_thread.h"
+
+// Include the private statistics kept when built with LINKED_LIST_STATS.
+#include "list_stats.h"
+
 // Include required stdlib headers.
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-// Defines a constant which will be used to check the string length of the
-// file name passed to load_data_from_file().
-#define MINIMUM_NAME_LENGTH 4
-
-// Defines a constant which will be used to indicate that a value was
-// successfully read from the input file in load_data_from_file().
-#define READ_SUCCESS 1
+// Defines a constant for the number of values the binary format converts and
+// checks at a time.
+#define BINARY_BATCH_SIZE 4096
+
+// Defines constants for the binary format: the magic bytes that start every
+// file, the version written, and the size of the header.  The header holds
+// the magic, the version and header size as 32-bit integers, then the element
+// count and the checksum as 64-bit integers, all little-endian.  The elements
+// follow as packed 32-bit little-endian integers.
+#define BINARY_MAGIC "CLLBIN\r\n"
+#define BINARY_MAGIC_LENGTH 8
+#define BINARY_VERSION 1
+#define BINARY_HEADER_SIZE 32
+
+// Defines a constant for the number of 32-bit words the checksum adds up
+// before reducing its sums, the most for which the second sum cannot
+// overflow 64 bits.
+#define CHECKSUM_BLOCK_WORDS 65536
+
+// Defines constants for the parallel traversals, which split the list into at
+// most PARALLEL_MAXIMUM_SEGMENTS segments of at least
+// PARALLEL_MINIMUM_SEGMENT_NODES nodes each.  Threads take segments one at a
+// time, so more segments than threads keeps every thread busy until the end.
+#define PARALLEL_MAXIMUM_SEGMENTS 64
+#define PARALLEL_MINIMUM_SEGMENT_NODES 4096
+
+// Defines a constant for how often a parallel search checks whether another
+// thread found an earlier match, as a mask of the node index.
+#define PARALLEL_CANCEL_CHECK_MASK 63
+
+// Starting point of a segment of the list used by the parallel traversals.
+// Contains:
+// - Pointer to the first node of the segment.
+// - Index of that node.
+typedef struct ListSegment
+{
+    IntegerNode *first;
+    size_t index;
+} ListSegment;
+
+// Defines the instrumentation of the public functions.  When built with
+// LINKED_LIST_STATS, STATS_BEGIN() starts timing a call, STATS_END() adds the
+// call to the statistics of an operation, STATS_TRAVERSED() charges the call
+// for walking past nodes, and STATS_COUNT() adds to one of the totals.
+// Otherwise every macro expands to nothing, leaving no trace in the code,
+// except that STATS_TRAVERSED() names its count in an unevaluated sizeof so
+// that variables only kept for the statistics are not reported as unused.
+#ifdef LINKED_LIST_STATS
+#define STATS_BEGIN(list) ListStatsTimer const statsTimer = list_stats_begin((list)->stats)
+#define STATS_END(list, operation) list_stats_end((list)->stats, (operation), &statsTimer)
+#define STATS_TRAVERSED(list, count) ((list)->stats->pendingTraversed += (count))
+#define STATS_COUNT(list, field, count) ((list)->stats->totals.field += (count))
+#else
+#define STATS_BEGIN(list) ((void)0)
+#define STATS_END(list, operation) ((void)0)
+#define STATS_TRAVERSED(list, count) ((void)sizeof(count))
+#define STATS_COUNT(list, field, count) ((void)0)
+#endif
 
 // Internal function that prints a diagnostic message and aborts the program in
 // the unlikely event that memory allocation fails.
@@ -32,555 +105,969 @@ static void internal_bad_alloc(void)
     abort();
 }
 
-// Internal function that prints a diagnostic message and aborts the program if
-// the user attempts to access an index which is outside the bounds of the list.
-static void internal_out_of_bounds(size_t const size, size_t const index)
+// Internal function that forgets the segments of the parallel traversals,
+// called whenever nodes are added, removed or reordered.
+static void internal_drop_segments(IntegerLinkedList *list)
 {
-    fprintf(stderr, "Attempt to access index out of range!\n");
-    fprintf(stderr, "Index %zu of list with size %zu.\n", index, size);
-    abort();
+    list->segmentCount = 0;
 }
 
-// Definition for a linked list node.
-// Contains:
-// - Pointer to the `next` node.
-// - Pointer to the `previous` node.
-// - Integer value being stored.
-typedef struct IntegerNode
+// Internal function that records a new node in the value index and the
+// aggregates, if they have been built, aborting the program if allocation
+// fails.
+static void internal_record_node(IntegerLinkedList *list, IntegerNode *node)
 {
-    struct IntegerNode *next;
-    struct IntegerNode *previous;
-    int data;
-} IntegerNode;
+    if (list->valueIndex && !value_index_insert(list->valueIndex, node))
+    {
+        internal_bad_alloc();
+    }
 
+    if (list->aggregates && !value_aggregates_insert(list->aggregates, node->data))
+    {
+        internal_bad_alloc();
+    }
+}
 
-// Initialize the linked list handle.
-bool linked_list_initialize(IntegerLinkedList *list)
+// Internal function that forgets a node about to be removed in the value
+// index and the aggregates, if they have been built.
+static void internal_forget_node(IntegerLinkedList *list, IntegerNode const *node)
 {
-    // Set the head pointer of the list to null.
-    list->head = NULL;
+    if (list->valueIndex) { value_index_remove(list->valueIndex, node); }
+    if (list->aggregates) { value_aggregates_remove(list->aggregates, node->data); }
+}
 
-    // Set the tail pointer of the list to null.
-    list->tail = NULL;
+// Internal function that empties the value index and aggregates when every
+// node is removed at once, keeping their tables for reuse.
+static void internal_clear_caches(IntegerLinkedList *list)
+{
+    if (list->valueIndex) { value_index_clear(list->valueIndex); }
+    if (list->aggregates) { value_aggregates_clear(list->aggregates); }
+}
 
-    // Set the element count to zero.
-    list->size = 0;
 
-    // Initialization success, return true.
-    return true;
+// Internal function that builds the value index from every node of the
+// list, aborting the program if allocation fails.  The index is only built
+// by the non-const functions, so that lookups through a const handle never
+// write to the list.
+static void internal_build_value_index(IntegerLinkedList *list)
+{
+    list->valueIndex = value_index_create();
+    if (!list->valueIndex) { internal_bad_alloc(); }
+
+    for (IntegerNode *node = list->head; node; node = node->next)
+    {
+        if (!value_index_insert(list->valueIndex, node)) { internal_bad_alloc(); }
+    }
+    STATS_TRAVERSED(list, list->size);
 }
 
-// Initialize the linked list handle and populate with values from a file.
-void linked_list_load_data_from_file(IntegerLinkedList *list, char const *fileName)
+// Internal function that builds a value index enabled lazily, once the first
+// lookup through a non-const handle needs it.
+static void internal_prepare_value_index(IntegerLinkedList *list)
 {
-    // Ensure a file name is provided, and that it contains enough characters
-    // for the file extension plus at least one character for the file name.
-    // If not, print a diagnostic message and return early.
-    if (!fileName || strlen(fileName) < MINIMUM_NAME_LENGTH)
+    if (list->valueIndexPending)
     {
-        fprintf(stderr, "ERROR: Please provide the name of a text (.txt) file.\n");
-        return;
+        list->valueIndexPending = false;
+        internal_build_value_index(list);
     }
+}
 
-    // Attempt to open a file of the provided name file for reading.
-    FILE *file = fopen(fileName, "r");
+// Internal function that builds the aggregates from every node of the list,
+// aborting the program if allocation fails.  Like the value index, they are
+// only built by the non-const functions.
+static void internal_build_aggregates(IntegerLinkedList *list)
+{
+    list->aggregates = value_aggregates_create();
+    if (!list->aggregates) { internal_bad_alloc(); }
+
+    for (IntegerNode const *node = list->head; node; node = node->next)
+    {
+        if (!value_aggregates_insert(list->aggregates, node->data)) { internal_bad_alloc(); }
+    }
+    STATS_TRAVERSED(list, list->size);
+}
 
-    // If the file failed to open print a diagnostic message and return early.
-    if (!file)
+// Internal function that rebuilds the value index, if there is one, once
+// compaction has moved every node it refers to.
+static void internal_rebuild_value_index(IntegerLinkedList *list)
+{
+    if (list->valueIndex)
     {
-        fprintf(stderr, "ERROR: Unable to open %s file.\n", fileName);
-        return;
+        value_index_destroy(list->valueIndex);
+        internal_build_value_index(list);
     }
+}
+
+// Internal function that prepares the members the integer list adds to the
+// handle, before the pool is created.  Returns false if allocation fails.
+static bool internal_initialize_extensions(IntegerLinkedList *list)
+{
+    // Values are searched node by node until an index is requested, and
+    // aggregates are computed by traversal until they are enabled.
+    list->valueIndex = NULL;
+    list->valueIndexPending = false;
+    list->aggregates = NULL;
+
+    // Segments are only computed by the first parallel traversal.
+    list->segments = NULL;
+    list->segmentCount = 0;
+
+#ifdef LINKED_LIST_STATS
+    // Allocate the statistics before the pool, which counts its slabs in them.
+    list->stats = list_stats_create();
+    if (!list->stats) { return false; }
+#endif
+
+    return true;
+}
 
-    // Buffer value used to hold data read from a single line in the file.
-    int value = 0;
+// Internal function that releases the members the integer list adds to the
+// handle, once the pool no longer counts in the statistics.
+static void internal_cleanup_extensions(IntegerLinkedList *list)
+{
+    value_index_destroy(list->valueIndex);
+    list->valueIndex = NULL;
+    list->valueIndexPending = false;
+    value_aggregates_destroy(list->aggregates);
+    list->aggregates = NULL;
+
+    free(list->segments);
+    list->segments = NULL;
+    list->segmentCount = 0;
+
+#ifdef LINKED_LIST_STATS
+    list_stats_destroy(list->stats);
+    list->stats = NULL;
+#endif
+}
+
+// Internal function that makes a pool created for the list count its slabs
+// in the list's statistics.
+static void internal_attach_pool(IntegerLinkedList *list, NodePool *pool)
+{
+#ifdef LINKED_LIST_STATS
+    pool->statistics = &list->stats->totals;
+#else
+    (void)list;
+    (void)pool;
+#endif
+}
 
-    // Read text from the file, line by line, converting the text to an
-    // integer and storing it in the previously defined value buffer.
-    while (fscanf(file, "%d", &value) == READ_SUCCESS)
+// Internal function that stops a pool the list no longer uses, but other
+// lists still share, from counting in statistics which may be released.
+static void internal_detach_pool(IntegerLinkedList *list, NodePool *pool)
+{
+#ifdef LINKED_LIST_STATS
+    if (pool->statistics == &list->stats->totals) { pool->statistics = NULL; }
+#else
+    (void)list;
+    (void)pool;
+#endif
+}
+
+// Defines the traits of the integer list: values compare with == and <, hash
+// as integers, are written with the buffered formatter, and parsed with the
+// text scanner.
+#define INTEGER_LIST_EQUAL(a, b) LINKED_LIST_SCALAR_EQUAL(a, b)
+#define INTEGER_LIST_LESS(a, b) LINKED_LIST_SCALAR_LESS(a, b)
+#define INTEGER_LIST_HASH(value) LINKED_LIST_INTEGER_HASH(value)
+#define INTEGER_LIST_FORMAT(buffer, value) output_buffer_append_int((buffer), *(value))
+#define INTEGER_LIST_PARSE(scanner, value) text_scanner_next((scanner), (value))
+
+// Defines the hooks of the integer list, see generic_linked_list.h.  They
+// keep the value index, aggregates, and parallel segments up to date, and
+// record the statistics through the STATS_*() macros.
+#define INTEGER_LIST_HOOKS_INITIALIZE(list) internal_initialize_extensions(list)
+#define INTEGER_LIST_HOOKS_CLEANUP(list) internal_cleanup_extensions(list)
+#define INTEGER_LIST_HOOKS_POOL_CREATED(list, pool) internal_attach_pool((list), (pool))
+#define INTEGER_LIST_HOOKS_POOL_RELEASED(list, pool) internal_detach_pool((list), (pool))
+#define INTEGER_LIST_HOOKS_TRACKED(list) ((list)->valueIndex || (list)->aggregates)
+#define INTEGER_LIST_HOOKS_RECORD(list, node) internal_record_node((list), (node))
+#define INTEGER_LIST_HOOKS_FORGET(list, node) internal_forget_node((list), (node))
+#define INTEGER_LIST_HOOKS_CLEAR(list) internal_clear_caches(list)
+#define INTEGER_LIST_HOOKS_RELOCATED(list) internal_rebuild_value_index(list)
+#define INTEGER_LIST_HOOKS_INDEXED(list) ((list)->valueIndex != NULL)
+#define INTEGER_LIST_HOOKS_INDEX_COUNT(list, value) value_index_count((list)->valueIndex, (value))
+#define INTEGER_LIST_HOOKS_INDEX_ANY(list, value) value_index_any((list)->valueIndex, (value))
+#define INTEGER_LIST_HOOKS_PREPARE_INDEX(list) internal_prepare_value_index(list)
+#define INTEGER_LIST_HOOKS_CHANGED(list) internal_drop_segments(list)
+#define INTEGER_LIST_HOOKS_BEGIN(list) STATS_BEGIN(list)
+#define INTEGER_LIST_HOOKS_END(list, operation) STATS_END((list), LINKED_LIST_OPERATION_##operation)
+#define INTEGER_LIST_HOOKS_TRAVERSED(list, count) STATS_TRAVERSED((list), (count))
+#define INTEGER_LIST_HOOKS_COUNT(list, field, count) STATS_COUNT((list), field, (count))
+
+// Defines every linked_list_*() function the generated lists share.
+DEFINE_LINKED_LIST_WITH_HOOKS(IntegerLinkedList, linked_list, int, INTEGER_LIST,
+                              INTEGER_LIST_HOOKS)
+
+// Internal function that returns true when the platform stores integers with
+// their least significant byte first, like the binary format does.
+static bool internal_is_little_endian(void)
+{
+    unsigned const probe = 1;
+    return *(unsigned char const *)&probe == 1;
+}
+
+// Internal functions that store and read integers in little-endian order.
+static void internal_store_u32(unsigned char *bytes, uint32_t const value)
+{
+    for (int i = 0; i < 4; ++i) { bytes[i] = (unsigned char)(value >> (8 * i)); }
+}
+
+static void internal_store_u64(unsigned char *bytes, uint64_t const value)
+{
+    for (int i = 0; i < 8; ++i) { bytes[i] = (unsigned char)(value >> (8 * i)); }
+}
+
+static uint32_t internal_read_u32(unsigned char const *bytes)
+{
+    uint32_t value = 0;
+    for (int i = 3; i >= 0; --i) { value = value << 8 | bytes[i]; }
+    return value;
+}
+
+static uint64_t internal_read_u64(unsigned char const *bytes)
+{
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; --i) { value = value << 8 | bytes[i]; }
+    return value;
+}
+
+// Running Fletcher-64 checksum of a sequence of 32-bit words.
+// Contains:
+// - Sum of the words, and sum of those sums, modulo 2^32 - 1.
+// - Number of words added since the sums were last reduced.
+typedef struct BinaryChecksum
+{
+    uint64_t first;
+    uint64_t second;
+    size_t pending;
+} BinaryChecksum;
+
+// Internal function that adds words to a checksum.  The sums are only reduced
+// every CHECKSUM_BLOCK_WORDS words, which keeps the loop to two additions per
+// word.
+static void internal_checksum_add(BinaryChecksum *checksum, uint32_t const *words,
+                                  size_t const count)
+{
+    for (size_t i = 0; i < count; ++i)
     {
-        // Add the previously read integer to the list.
-        linked_list_push_back(list, value);
+        checksum->first += words[i];
+        checksum->second += checksum->first;
+
+        if (++checksum->pending == CHECKSUM_BLOCK_WORDS)
+        {
+            checksum->first %= UINT32_MAX;
+            checksum->second %= UINT32_MAX;
+            checksum->pending = 0;
+        }
     }
+}
 
-    // Close the file, releasing the resource back to the system.
-    fclose(file);
+// Internal function that returns the final value of a checksum.
+static uint64_t internal_checksum_value(BinaryChecksum const *checksum)
+{
+    return (checksum->second % UINT32_MAX) << 32 | (checksum->first % UINT32_MAX);
 }
 
-// Cleanup function that frees all allocated memory resources.  The
-// implementation of cleanup() would've been the same as clear(), so 
-// the program simply calls the clear() function.
-void linked_list_cleanup(IntegerLinkedList *list)
+// Internal function that writes the header of the binary format.
+static bool internal_write_binary_header(FILE *file, uint64_t const count,
+                                         uint64_t const checksum)
 {
-    linked_list_clear(list);
+    unsigned char header[BINARY_HEADER_SIZE];
+    memcpy(header, BINARY_MAGIC, BINARY_MAGIC_LENGTH);
+    internal_store_u32(header + 8, BINARY_VERSION);
+    internal_store_u32(header + 12, BINARY_HEADER_SIZE);
+    internal_store_u64(header + 16, count);
+    internal_store_u64(header + 24, checksum);
+    return fwrite(header, 1, sizeof(header), file) == sizeof(header);
 }
 
-// Clears the linked list by iterating over every node and freeing that node
-// before finally setting the head and tail pointers of the list handle
-// to null.
-void linked_list_clear(IntegerLinkedList *list)
+// Saves the list to a file in the binary format, which unlike the text of
+// linked_list_output_to_file() can be loaded again exactly, with
+// linked_list_load_binary().  The elements are written in batches as they are
+// walked, and the header is written again with the checksum at the end.
+LinkedListBinaryStatus linked_list_save_binary(IntegerLinkedList *list, char const *fileName)
 {
-    // Store two pointers, the current pointer and the next pointer in the
-    // list.  Store `next` because if `current` is freed without a handle to the
-    // next node, the chain is broken and a memory leak will result.
-    IntegerNode *current = list->head;
-    IntegerNode *next = NULL;
+    FILE *file = fileName ? fopen(fileName, "wb") : NULL;
+    if (!file) { return LINKED_LIST_BINARY_OPEN_FAILED; }
+
+    STATS_BEGIN(list);
 
-    // Starting at the head, loop through every node in the list, stopping
-    // once current is null.
-    while (current)
+    // Reserve the header, then write the elements a batch at a time,
+    // converted to little-endian words and added to the checksum.
+    bool written = internal_write_binary_header(file, list->size, 0);
+    BinaryChecksum checksum = { 0, 0, 0 };
+    uint32_t batch[BINARY_BATCH_SIZE];
+    bool const littleEndian = internal_is_little_endian();
+    IntegerNode const *node = list->head;
+
+    while (written && node)
     {
-        // Store the pointer for the next node in the list.
-        next = current->next;
+        size_t count = 0;
+        for (; node && count < BINARY_BATCH_SIZE; node = node->next)
+        {
+            batch[count++] = (uint32_t)node->data;
+        }
 
-        // Free the current node.
-        free(current);
+        internal_checksum_add(&checksum, batch, count);
 
-        // Assign the `next` pointer to `current` so that the loop will continue.
-        current = next;
+        if (!littleEndian)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                internal_store_u32((unsigned char *)&batch[i], batch[i]);
+            }
+        }
+
+        written = fwrite(batch, sizeof(uint32_t), count, file) == count;
     }
 
-    // Once every node in the loop has been cleared, set the element count to 
-    // zero, and set both the head and tail pointers of the list handle to null.
-    list->size = 0;
-    list->head = NULL;
-    list->tail = NULL;
+    // Complete the header now that the checksum is known.
+    written = written && fseek(file, 0, SEEK_SET) == 0 &&
+              internal_write_binary_header(file, list->size, internal_checksum_value(&checksum));
+    written = fclose(file) == 0 && written;
+
+    STATS_TRAVERSED(list, list->size);
+    STATS_END(list, LINKED_LIST_OPERATION_OUTPUT);
+    return written ? LINKED_LIST_BINARY_OK : LINKED_LIST_BINARY_WRITE_FAILED;
 }
 
-// Appends a node to the end of the list that stores the value passed as an
-// argument.
-void linked_list_push_back(IntegerLinkedList *list, int const value)
+// Appends the elements stored in a file of the binary format to the list.
+// The file is mapped into memory and checked in full, header and checksum,
+// before the list is touched, so a damaged file leaves the list unchanged.
+// The elements are then appended as one block of nodes, copied straight from
+// the mapping on little-endian platforms.
+LinkedListBinaryStatus linked_list_load_binary(IntegerLinkedList *list, char const *fileName)
 {
-    // Allocate memory for the new node.
-    IntegerNode *node = (IntegerNode *)malloc(sizeof(IntegerNode));
+    MappedFile mapping;
+    if (!fileName || !file_mapping_open(&mapping, fileName))
+    {
+        return LINKED_LIST_BINARY_OPEN_FAILED;
+    }
 
-    // If allocation fails, print a diagnostic message and abort the program.
-    if (!node) { internal_bad_alloc(); }
+    STATS_BEGIN(list);
 
-    // Since the node will be at the end of the list, the `next` pointer  will
-    // be null.
-    node->next = NULL;
+    unsigned char const *bytes = (unsigned char const *)mapping.data;
+    LinkedListBinaryStatus status = LINKED_LIST_BINARY_OK;
+    uint64_t count = 0;
+    size_t headerSize = BINARY_HEADER_SIZE;
 
-    // Assign the value of the argument to the node.
-    node->data = value;
+    // Check the header.  Later versions may grow the header, but keep the
+    // fields of this one in place.
+    if (mapping.length < BINARY_HEADER_SIZE ||
+        memcmp(bytes, BINARY_MAGIC, BINARY_MAGIC_LENGTH) != 0)
+    {
+        status = LINKED_LIST_BINARY_NOT_BINARY_LIST;
+    }
+    else if (internal_read_u32(bytes + 8) != BINARY_VERSION)
+    {
+        status = LINKED_LIST_BINARY_UNSUPPORTED_VERSION;
+    }
+    else
+    {
+        headerSize = internal_read_u32(bytes + 12);
+        count = internal_read_u64(bytes + 16);
 
-    // If the `tail` pointer is not null a node exists at the end of the list.
-    if (list->tail)
+        // The elements are read in place, so they must start on a word
+        // boundary, and must fill the rest of the file exactly.
+        if (headerSize < BINARY_HEADER_SIZE || headerSize % sizeof(uint32_t) != 0)
+        {
+            status = LINKED_LIST_BINARY_NOT_BINARY_LIST;
+        }
+        else if (headerSize > mapping.length ||
+                 (mapping.length - headerSize) % sizeof(uint32_t) != 0 ||
+                 (mapping.length - headerSize) / sizeof(uint32_t) != count)
+        {
+            status = LINKED_LIST_BINARY_TRUNCATED;
+        }
+    }
+
+    // Check the elements against the checksum.  The mapping is page aligned
+    // and the header size was checked to be a multiple of four bytes, so the
+    // words can be read in place once the header is known to be valid.
+    uint32_t const *words = NULL;
+    bool const littleEndian = internal_is_little_endian();
+
+    if (status == LINKED_LIST_BINARY_OK)
     {
-        // Set the local node's `previous` pointer to point to the last node
-        // currently in the list.
-        node->previous = list->tail;
+        words = (uint32_t const *)(bytes + headerSize);
+
+        BinaryChecksum checksum = { 0, 0, 0 };
+        uint32_t batch[BINARY_BATCH_SIZE];
+
+        for (size_t first = 0; first < count; first += BINARY_BATCH_SIZE)
+        {
+            size_t const length = count - first < BINARY_BATCH_SIZE ? count - first : BINARY_BATCH_SIZE;
+            uint32_t const *source = words + first;
 
-        // Set the `next` pointer of the last node currently in the list to 
-        // the local node, inserting the node into the list.
-        list->tail->next = node;
+            if (!littleEndian)
+            {
+                for (size_t i = 0; i < length; ++i)
+                {
+                    batch[i] = internal_read_u32((unsigned char const *)&source[i]);
+                }
+                source = batch;
+            }
 
-        // Set the `tail` pointer of the list handle to the local node, which
-        // was previously inserted into the end of the list.
-        list->tail = node;
+            internal_checksum_add(&checksum, source, length);
+        }
+
+        if (internal_checksum_value(&checksum) != internal_read_u64(bytes + 24))
+        {
+            status = LINKED_LIST_BINARY_CHECKSUM_MISMATCH;
+        }
     }
-    else
+
+    // Append the elements, in one block where the words already are ints.
+    if (status == LINKED_LIST_BINARY_OK)
     {
-        // If tail is null there are no nodes in the list, so set the `previous`
-        // pointer to null, and point both `head` and `tail` to the local node,
-        // inserting it into the list.
-        node->previous = NULL;
-        list->head = node;
-        list->tail = node;
+        if (littleEndian)
+        {
+            linked_list_internal_append_values(list, (int const *)words, (size_t)count);
+        }
+        else
+        {
+            int batch[BINARY_BATCH_SIZE];
+            for (size_t first = 0; first < count; first += BINARY_BATCH_SIZE)
+            {
+                size_t const length = count - first < BINARY_BATCH_SIZE ? count - first
+                                                                      : BINARY_BATCH_SIZE;
+                for (size_t i = 0; i < length; ++i)
+                {
+                    batch[i] = (int)internal_read_u32((unsigned char const *)&words[first + i]);
+                }
+                linked_list_internal_append_values(list, batch, length);
+            }
+        }
+
+        // A sorted list puts the loaded values in their place.
+        if (list->sortedMode) { linked_list_internal_sort_nodes(list); }
+
+        // Compact the list if automatic compaction is due.
+        linked_list_internal_auto_compact(list);
     }
 
-    // Increment the list size following node insertion.
-    ++list->size;
+    file_mapping_close(&mapping);
+
+    STATS_END(list, LINKED_LIST_OPERATION_LOAD);
+    return status;
 }
 
-// Appends a node to the front of the list that stores the value passed as an
-// argument.
-void linked_list_push_front(IntegerLinkedList *list, int const value)
+// Opts the list in to a hash index from each value to the nodes storing it,
+// making contains() and remove_value() independent of the list length, and
+// find_first_index_containing() immediate for a value which is not stored.
+// The index is built from every node here, then kept up to date by every
+// modifier, at the cost of extra memory and slower insertion and removal.
+// Lookups only read the index, so they remain safe to call from several
+// threads at once while the list is not changed.
+void linked_list_enable_value_index(IntegerLinkedList *list)
 {
-    // Allocate memory for the new node.
-    IntegerNode *node = (IntegerNode *)malloc(sizeof(IntegerNode));
-
-    // If allocation fails, print a diagnostic message and abort the program.
-    if (!node) { internal_bad_alloc(); }
+    list->valueIndexPending = false;
+    if (!list->valueIndex) { internal_build_value_index(list); }
+}
 
-    // Since the node will be at the front of the list, the `previous` pointer
-    // will be null.
-    node->previous = NULL;
+// Opts the list in to the value index like enable_value_index(), but defers
+// building it to the first remove_value() or remove_values(), so that a list
+// filled after this call does not keep an index up to date until one is
+// used.  Until then, contains() and find_first_index_containing() scan the
+// list, since a const handle never builds the index.
+void linked_list_enable_lazy_value_index(IntegerLinkedList *list)
+{
+    if (!list->valueIndex) { list->valueIndexPending = true; }
+}
 
-    // Assign the value of the argument to the node.
-    node->data = value;
+// Releases the value index and returns to scanning the list for values.
+void linked_list_disable_value_index(IntegerLinkedList *list)
+{
+    value_index_destroy(list->valueIndex);
+    list->valueIndex = NULL;
+    list->valueIndexPending = false;
+}
 
-    // If the `head` pointer is not null a node exists at the front of the list.
-    if (list->head)
-    {
-        // Set the local node's `next` pointer to point to the first node
-        // currently in the list.
-        node->next = list->head;
+// Returns the sum of every element of the list, zero for an empty list.  With
+// aggregates enabled the sum is kept up to date by every modifier, otherwise
+// the list is traversed.
+long long linked_list_sum(IntegerLinkedList const *list)
+{
+    STATS_BEGIN(list);
 
-        // Set the `previous` pointer of the first node currently in the list to 
-        // the local node, inserting the node into the list.
-        list->head->previous = node;
+    ValueAggregates const *aggregates = list->aggregates;
+    long long sum = 0;
 
-        // Set the `head` pointer of the list handle to the local node, which
-        // was previously inserted into the front of the list.
-        list->head = node;
+    if (aggregates)
+    {
+        sum = value_aggregates_sum(aggregates);
     }
     else
     {
-        // If head is null there are no nodes in the list, so set the `next`
-        // pointer to null, and point both `head` and `tail` to the local node,
-        // inserting it into the list.
-        node->next = NULL;
-        list->head = node;
-        list->tail = node;
+        for (IntegerNode const *node = list->head; node; node = node->next) { sum += node->data; }
+        STATS_TRAVERSED(list, list->size);
     }
-    
-    // Increment the list size following node insertion.
-    ++list->size;
+
+    STATS_END(list, LINKED_LIST_OPERATION_AGGREGATE);
+    return sum;
 }
 
-// Removes the last node in the list.
-void linked_list_pop_back(IntegerLinkedList *list)
+// Internal function that finds the smallest or largest element of the list,
+// storing it in `value`.  Returns false if the list is empty.
+static bool internal_extreme(IntegerLinkedList const *list, int *value, bool const largest)
 {
-    // If the `tail` pointer of the handle is null, the list is empty.
-    if (!list->tail) { return; }
-
-    // Check that the node pointed too by tail also points to a previous node.
-    if (list->tail->previous)
-    {
-        // Set the `tail` pointer of the handle to point to the second to
-        // last node in the list.
-        list->tail = list->tail->previous;
+    if (!list->head) { return false; }
 
-        // Use the `next` pointer of the second to last node in the list to
-        // free the last node in the list, removing the item from the list
-        // and relinquishing its memory resource.
-        free(list->tail->next);
+    STATS_BEGIN(list);
 
-        // After freeing, set the `next` pointer of the last node in the list 
-        // to null.
-        list->tail->next = NULL;
+    ValueAggregates const *aggregates = list->aggregates;
 
-        // Decrement the number of elements in the list.
-        --list->size;
+    if (aggregates)
+    {
+        *value = largest ? value_aggregates_maximum(aggregates)
+                         : value_aggregates_minimum(aggregates);
     }
     else
     {
-        // If the tail node does not point to another node, there is only
-        // one element in the list, so simply call clear().
-        linked_list_clear(list);
+        // A sorted list holds its extremes at its ends.
+        int extreme = largest ? list->tail->data : list->head->data;
+
+        if (!list->sortedMode)
+        {
+            for (IntegerNode const *node = list->head; node; node = node->next)
+            {
+                if (largest ? node->data > extreme : node->data < extreme) { extreme = node->data; }
+            }
+            STATS_TRAVERSED(list, list->size);
+        }
+
+        *value = extreme;
     }
+
+    STATS_END(list, LINKED_LIST_OPERATION_AGGREGATE);
+    return true;
 }
 
-// Removes the first node in the list.
-void linked_list_pop_front(IntegerLinkedList *list)
+// Stores the smallest element of the list in `value`.  Returns false, leaving
+// `value` unchanged, if the list is empty.
+bool linked_list_minimum(IntegerLinkedList const *list, int *value)
 {
-    // If the `head` pointer of the handle is null, the list is empty.
-    if (!list->head) { return; }
+    return internal_extreme(list, value, false);
+}
 
-    // Check that the node pointed too by head also points to a next node.
-    if (list->head->next)
-    {
-        // Set the `head` pointer of the handle to point to the second node
-        // in the list.
-        list->head = list->head->next;
+// Stores the largest element of the list in `value`.  Returns false, leaving
+// `value` unchanged, if the list is empty.
+bool linked_list_maximum(IntegerLinkedList const *list, int *value)
+{
+    return internal_extreme(list, value, true);
+}
 
-        // Use the `previous` pointer of the second node in the list to
-        // free the first node in the list, removing the item from the list
-        // and relinquishing its memory resource.
-        free(list->head->previous);
+// Returns the number of elements of the list equal to `value`, answered by
+// the aggregates or the value index if either is enabled, otherwise by
+// traversing the list.
+size_t linked_list_count_value(IntegerLinkedList const *list, int const value)
+{
+    STATS_BEGIN(list);
 
-        // After freeing, set the `previous` pointer of the first node in the
-        // list to null.
-        list->head->previous = NULL;
+    ValueAggregates const *aggregates = list->aggregates;
+    ValueIndex const *valueIndex = aggregates ? NULL : list->valueIndex;
+    size_t count = 0;
 
-        // Decrement the number of elements in the list.
-        --list->size;
+    if (aggregates)
+    {
+        count = value_aggregates_count(aggregates, value);
+    }
+    else if (valueIndex)
+    {
+        count = value_index_count(valueIndex, value);
     }
     else
     {
-        // If the head node does not point to another node, there is only
-        // one element in the list, so simply call clear().
-        linked_list_clear(list);
+        for (IntegerNode const *node = list->head; node; node = node->next)
+        {
+            if (node->data == value) { ++count; }
+        }
+        STATS_TRAVERSED(list, list->size);
     }
+
+    STATS_END(list, LINKED_LIST_OPERATION_AGGREGATE);
+    return count;
 }
 
-// Removes a node at the specified index.
-void linked_list_remove_at_index(IntegerLinkedList *list, size_t const index)
+// Opts the list in to aggregates of its values, making sum(), minimum(),
+// maximum() and count_value() independent of the list length.  The aggregates
+// are built from every node here, then kept up to date by every modifier, at
+// the cost of extra memory and slower insertion and removal.  The minimum and
+// maximum are found in heaps from which removed values are dropped by the
+// removals, so the queries only read the aggregates.
+void linked_list_enable_aggregates(IntegerLinkedList *list)
 {
-    // If the index passed as an argument is greater than the number of
-    // elements in the list, print a diagnostic message and abort.
-    if (index >= list->size) { internal_out_of_bounds(list->size, index); }
+    if (!list->aggregates) { internal_build_aggregates(list); }
+}
 
-    // Store a pointer to the first node in the list.
-    IntegerNode *node = list->head;
+// Releases the aggregates and returns to traversing the list for every query.
+void linked_list_disable_aggregates(IntegerLinkedList *list)
+{
+    value_aggregates_destroy(list->aggregates);
+    list->aggregates = NULL;
+}
 
-    // Declare and zero out an accumulator variable to track the current index.
-    size_t nodeIndex = 0;
+// Kind of work a parallel traversal performs on each segment.
+typedef enum ParallelTask
+{
+    PARALLEL_TASK_FOR_EACH,
+    PARALLEL_TASK_REDUCE,
+    PARALLEL_TASK_COUNT,
+    PARALLEL_TASK_FIND
+} ParallelTask;
 
-    // Iterate through the list until the node at the desired index is found, 
-    // or the end of the list is reached.
-    while (nodeIndex < index)
-    {
-        // Each iteration of the loop, store the pointer to the next node,
-        // and increment the accumulator.
-        node = node->next;
-        ++nodeIndex;
-    }
+// Work shared by the threads of a parallel traversal.
+// Contains:
+// - Pointer to the list, whose segments have been computed.
+// - Kind of work, and the callback and context performing it.
+// - Starting value of a reduction.
+// - Result of each segment, for reductions and counts.
+// - Index of the next segment no thread has taken yet.
+// - Lowest index at which a search has found a match so far.
+typedef struct ParallelJob
+{
+    IntegerLinkedList *list;
+    ParallelTask task;
+    LinkedListVisitor visitor;
+    LinkedListReducer reducer;
+    LinkedListPredicate predicate;
+    void *context;
+    long long identity;
+    long long results[PARALLEL_MAXIMUM_SEGMENTS];
+    _Atomic size_t nextSegment;
+    _Atomic size_t found;
+} ParallelJob;
+
+// Internal function that splits the list into segments of roughly equal size,
+// recording the first node and index of each.  The segments are kept until
+// the list changes, so repeated traversals of an unchanged list do not walk
+// it again to find them.  The list must not be empty.
+static void internal_compute_segments(IntegerLinkedList *list)
+{
+    if (list->segmentCount) { return; }
 
-    if (node == list->head)
+    if (!list->segments)
     {
-        // If after iteration is finished, the desired node is at the front of the
-        // list, simply call pop_front() and return.
-        linked_list_pop_front(list);
-        return;
+        list->segments = malloc(PARALLEL_MAXIMUM_SEGMENTS * sizeof(ListSegment));
+        if (!list->segments) { internal_bad_alloc(); }
     }
-    
-    if (node == list->tail)
+
+    // Use as many segments as the list has room for, the last one also takes
+    // the nodes left over by the division.
+    size_t count = list->size / PARALLEL_MINIMUM_SEGMENT_NODES;
+    if (count > PARALLEL_MAXIMUM_SEGMENTS) { count = PARALLEL_MAXIMUM_SEGMENTS; }
+    if (count == 0) { count = 1; }
+
+    size_t const stride = list->size / count;
+    IntegerNode *node = list->head;
+
+    for (size_t i = 0; i < count; ++i)
     {
-        // If after iteration is finished, the desired node is at the back of the
-        // list, simply call pop_back() and return.
-        linked_list_pop_back(list);
-        return;
-    }
+        list->segments[i].first = node;
+        list->segments[i].index = i * stride;
 
-    // Otherwise, set the `next` pointer of the previous node to point to the
-    // next node in the list.
-    node->previous->next = node->next;
+        if (i + 1 < count)
+        {
+            for (size_t j = 0; j < stride; ++j) { node = node->next; }
+        }
+    }
 
-    // Then set the `previous` pointer of the next node to point to the previous
-    // node in the list, removing the node from the list.
-    node->next->previous = node->previous;
+    STATS_TRAVERSED(list, (count - 1) * stride);
+    list->segmentCount = count;
+}
 
-    // The local node points to the removed node, free said node, relinquishing
-    // its memory resource.
-    free(node);
+// Internal function that lowers the index of the earliest match found by a
+// parallel search to `index`, unless an earlier match is already known.
+static void internal_record_match(ParallelJob *job, size_t const index)
+{
+    size_t found = atomic_load(&job->found);
 
-    // Decrement the number of elements in the list.
-    --list->size;
+    while (index < found && !atomic_compare_exchange_weak(&job->found, &found, index)) {}
 }
 
-// Removes all nodes from the list that contain the specified value.
-void linked_list_remove_value(IntegerLinkedList *list, int const value)
+// Internal function run by every thread of a parallel traversal.  Threads
+// take segments in list order until none are left.
+static void internal_parallel_worker(void *argument)
 {
-    // Store a pointer to the first node in the list.
-    IntegerNode *node = list->head;
+    ParallelJob *job = (ParallelJob *)argument;
+    IntegerLinkedList const *list = job->list;
 
-    // Iterate through the list until a node with the desired value if found,
-    // or the end of the list is reached.
-    while (node)
+    for (;;)
     {
-        if (node->data == value)
+        size_t const segment = atomic_fetch_add(&job->nextSegment, 1);
+        if (segment >= list->segmentCount) { return; }
+
+        IntegerNode *node = list->segments[segment].first;
+        size_t index = list->segments[segment].index;
+        size_t const end = segment + 1 < list->segmentCount ? list->segments[segment + 1].index
+                                                            : list->size;
+
+        switch (job->task)
         {
-            // When a node containing the desired value is found, check if the
-            // node is at the beginning of the list, if so, set the local node
-            // to point to the next node, call pop_front() and continue iteration.
-            if (node == list->head)
+            case PARALLEL_TASK_FOR_EACH:
+                for (; index < end; ++index, node = node->next)
+                {
+                    job->visitor(&node->data, job->context);
+                }
+                break;
+
+            case PARALLEL_TASK_REDUCE:
             {
-                node = node->next;
-                linked_list_pop_front(list);
-                continue;
+                long long accumulator = job->identity;
+                for (; index < end; ++index, node = node->next)
+                {
+                    accumulator = job->reducer(accumulator, node->data, job->context);
+                }
+                job->results[segment] = accumulator;
+                break;
             }
 
-            // When a node containing the desired value is found, check if the
-            // node is at the end of the list, if so, simply call
-            // pop_back() and since that's the last element in the list, return.
-            if (node == list->tail)
+            case PARALLEL_TASK_COUNT:
             {
-                linked_list_pop_back(list);
-                return;
+                long long count = 0;
+                for (; index < end; ++index, node = node->next)
+                {
+                    if (job->predicate(node->data, job->context)) { ++count; }
+                }
+                job->results[segment] = count;
+                break;
             }
 
-            // Otherwise, set the `next` pointer of the previous node to point
-            // to the next item in the list.
-            node->previous->next = node->next;
+            case PARALLEL_TASK_FIND:
+                // Segments are taken in list order, so once a match lies
+                // before this segment, so does it for every segment left.
+                if (atomic_load(&job->found) < index) { return; }
+
+                for (; index < end; ++index, node = node->next)
+                {
+                    if (job->predicate(node->data, job->context))
+                    {
+                        internal_record_match(job, index);
+                        break;
+                    }
+
+                    // Give up once another thread matched earlier nodes.
+                    if ((index & PARALLEL_CANCEL_CHECK_MASK) == 0 && atomic_load(&job->found) < index)
+                    {
+                        break;
+                    }
+                }
+                break;
+        }
+    }
+}
 
-            // Then set the `previous` pointer of the next node to point to the
-            // previous node in the list.
-            node->next->previous = node->previous;
+// Internal function that runs a parallel traversal on up to `threadCount`
+// threads, one per processor if `threadCount` is zero, including the calling
+// thread.  Threads are started for the traversal and joined before it
+// returns.  A thread which cannot be started is not needed, the remaining
+// threads take its segments.  The list must not be empty.
+static void internal_run_parallel(ParallelJob *job, size_t const threadCount)
+{
+    IntegerLinkedList *list = job->list;
+    internal_compute_segments(list);
 
-            // Store a pointer to the node after the one about to be freed.
-            // This must be done because after freeing the node, the pointer to
-            // the next link in the chain is lost.
-            IntegerNode *temp = node->next;
+    atomic_init(&job->nextSegment, 0);
+    atomic_init(&job->found, list->size);
 
-            // The local node points to the removed node, free said node,
-            // relinquishing its memory resource.
-            free(node);
+    size_t threads = threadCount ? threadCount : platform_processor_count();
+    if (threads > list->segmentCount) { threads = list->segmentCount; }
 
-            // Decrement the number of elements in the list.
-            --list->size;
+    PlatformThread workers[PARALLEL_MAXIMUM_SEGMENTS];
+    bool started[PARALLEL_MAXIMUM_SEGMENTS];
 
-            // Set the local node to be the temporary node previously stored,
-            // allowing the next iteration to continue where it left off.
-            node = temp;
+    for (size_t i = 1; i < threads; ++i)
+    {
+        started[i] = platform_thread_start(&workers[i], internal_parallel_worker, job);
+    }
 
-            // Finally `continue` is called to avoid skipping over the next node.
-            continue;
-        }
-        // Update the local node to point to the next node in the list,
-        // continuing iteration.
-        node = node->next;
+    internal_parallel_worker(job);
+
+    for (size_t i = 1; i < threads; ++i)
+    {
+        if (started[i]) { platform_thread_join(&workers[i]); }
     }
 }
 
-// Returns the value stored by the last node in the list.
-int linked_list_back(IntegerLinkedList const *list)
+// Internal reducer that adds values together, for linked_list_parallel_sum().
+static long long internal_add(long long const accumulator, long long const value, void *context)
 {
-    return list->tail->data;
+    (void)context;
+    return accumulator + value;
 }
 
-// Returns the value stored by the first node in the list.
-int linked_list_front(IntegerLinkedList const *list)
+// Internal predicate that matches one value, passed through `context`.
+static bool internal_equals(int const value, void *context)
 {
-    return list->head->data;
+    return value == *(int const *)context;
 }
 
-// Returns the value stored at the specified node.
-int linked_list_element_at(IntegerLinkedList const *list, size_t const index)
+// Calls `visitor` with a pointer to every element of the list, splitting the
+// list into segments that are visited on up to `threadCount` threads, or one
+// per processor if `threadCount` is zero.  The visitor is called from several
+// threads at once, each element exactly once, in no particular order.  The
+// visitor may change the element it is given, in which case the value index
+// and aggregates are rebuilt, and a list in sorted mode is sorted again.
+void linked_list_parallel_for_each(IntegerLinkedList *list, LinkedListVisitor const visitor,
+                                   void *context, size_t const threadCount)
 {
-    // If the index passed as an argument is greater than the number of
-    // elements in the list, print a diagnostic message and abort.
-    if (index >= list->size) { internal_out_of_bounds(list->size, index); }
+    if (list->size == 0) { return; }
 
-    // Store a pointer to the first node in the list.
-    IntegerNode *node = list->head;
+    STATS_BEGIN(list);
 
-    // Declare and zero out an accumulator variable to track the current index.
-    size_t nodeIndex = 0;
+    ParallelJob job;
+    job.list = list;
+    job.task = PARALLEL_TASK_FOR_EACH;
+    job.visitor = visitor;
+    job.context = context;
+    internal_run_parallel(&job, threadCount);
 
-    // Iterate through the list until the node at the desired index is found. 
-    while (nodeIndex < index)
+    // The visitor may have changed any value, so rebuild the value index and
+    // the aggregates from the new values.
+    if (list->valueIndex)
     {
-        // Each iteration of the loop, store the pointer to the next node,
-        // and increment the accumulator.
-        node = node->next;
-        ++nodeIndex;
+        value_index_destroy(list->valueIndex);
+        internal_build_value_index(list);
     }
 
-    // After the desired node is found, return the value it contains.
-    return node->data;
-}
-
-// Writes the contents of the list to a file.
-void linked_list_output_to_file(IntegerLinkedList *list, char const *fileName)
-{
-    // Ensure a file name is provided, and that it contains enough characters
-    // for the file extension plus at least one character for the file name.
-    // If not, print a diagnostic message and return early.
-    if (!fileName || strlen(fileName) < MINIMUM_NAME_LENGTH)
+    if (list->aggregates)
     {
-        fprintf(stderr, "ERROR: Please provide the name of a text (.txt) file.\n");
-        return;
+        value_aggregates_destroy(list->aggregates);
+        internal_build_aggregates(list);
     }
 
-    // Attempt to open a file of the provided name file for writing.
-    FILE *file = fopen(fileName, "w");
+    if (list->sortedMode) { linked_list_internal_sort_nodes(list); }
 
-    // If the file failed to open print a diagnostic message and return early.
-    if (!file)
-    {
-        fprintf(stderr, "ERROR: Unable to open %s file.\n", fileName);
-        return;
-    }
+    STATS_TRAVERSED(list, list->size);
+    STATS_END(list, LINKED_LIST_OPERATION_PARALLEL_FOR_EACH);
+}
 
-    // Store a pointer to the first node in the list.
-    IntegerNode *node = list->head;
+// Folds every element of the list into a single result with `reducer`, on up
+// to `threadCount` threads, or one per processor if `threadCount` is zero.
+// Each segment of the list is folded starting from `identity`, and the
+// results of the segments are then folded together in list order, so the
+// reducer must be associative and `identity` must leave a value unchanged,
+// such as zero for a sum.  The reducer is called from several threads at
+// once.  Returns `identity` for an empty list.
+long long linked_list_parallel_reduce(IntegerLinkedList *list, LinkedListReducer const reducer,
+                                      long long const identity, void *context,
+                                      size_t const threadCount)
+{
+    if (list->size == 0) { return identity; }
 
-    // Log the number of elements in the list with appropriate grammar.
-    if (list->size == 1)
-    {
-        fprintf(file, "List contains %zu element.\n", list->size);
-    }
-    else
-    {
-        fprintf(file, "List contains %zu elements.\n", list->size);
-    }
+    STATS_BEGIN(list);
 
-    // Log an opening brace, indicating the start of the list elements.
-    fprintf(file, "{");
+    ParallelJob job;
+    job.list = list;
+    job.task = PARALLEL_TASK_REDUCE;
+    job.reducer = reducer;
+    job.context = context;
+    job.identity = identity;
+    internal_run_parallel(&job, threadCount);
 
-    // Iterate through every node in the list.
-    while (node)
+    long long result = identity;
+    for (size_t i = 0; i < list->segmentCount; ++i)
     {
-        // Log the value stored in the current node, preceded by a space.
-        fprintf(file, " %d", node->data);
-
-        // If there is another node in the list, log a comma to communicate
-        // separate elements of the list.
-        if ((node = node->next)) { fprintf(file, ","); }
+        result = reducer(result, job.results[i], context);
     }
 
-    // Finally, log the closing brace padded by one space and followed by a 
-    // newline to the console to communicate the end of the list.
-    fprintf(file, " }\n\n");
-    
-    // Close the file, releasing the resource back to the system.
-    fclose(file);
+    STATS_TRAVERSED(list, list->size);
+    STATS_END(list, LINKED_LIST_OPERATION_PARALLEL_REDUCE);
+    return result;
 }
 
-// Returns the index of the first node that contains the desired value if the 
-// value exists in the list, otherwise the size of the list is returned.
-size_t linked_list_find_first_index_containing(IntegerLinkedList const *list, int const value)
+// Returns the sum of every element of the list, computed on up to
+// `threadCount` threads, or one per processor if `threadCount` is zero.
+long long linked_list_parallel_sum(IntegerLinkedList *list, size_t const threadCount)
 {
-    // Store a pointer to the first node in the list.
-    IntegerNode *node = list->head;
+    return linked_list_parallel_reduce(list, internal_add, 0, NULL, threadCount);
+}
 
-    // Declare and zero out an accumulator variable to track the current index.
-    size_t index = 0;
+// Returns the number of elements satisfying the predicate, counted on up to
+// `threadCount` threads, or one per processor if `threadCount` is zero.  The
+// predicate is called from several threads at once.
+size_t linked_list_parallel_count_if(IntegerLinkedList *list, LinkedListPredicate const predicate,
+                                     void *context, size_t const threadCount)
+{
+    if (list->size == 0) { return 0; }
 
-    // Iterate through the list until the node at the desired index is found. 
-    while (node)
-    {
-        // If the current node contains the desired value, return the value
-        // stored in the accumulator.
-        if (node->data == value) { return index; }
-
-        // Each iteration of the loop, store the pointer to the next node,
-        // and increment the accumulator.
-        node = node->next;
-        ++index;
-    }
+    STATS_BEGIN(list);
+
+    ParallelJob job;
+    job.list = list;
+    job.task = PARALLEL_TASK_COUNT;
+    job.predicate = predicate;
+    job.context = context;
+    internal_run_parallel(&job, threadCount);
 
-    // If the end of the list is reached without finding the specified value,
-    // return the value stored in the accumulator.  This value will be equal
-    // to the size of the list, allowing the caller an easy way to check for 
-    // value not found.  i.e. `if (return_value == list.size) { //not found }`
-    return index;
+    size_t count = 0;
+    for (size_t i = 0; i < list->segmentCount; ++i) { count += (size_t)job.results[i]; }
+
+    STATS_TRAVERSED(list, list->size);
+    STATS_END(list, LINKED_LIST_OPERATION_PARALLEL_REDUCE);
+    return count;
 }
 
-// Print the size of the list as well as each element in the list to stdout.
-void linked_list_print_list(IntegerLinkedList const *list)
+// Returns the index of the first element satisfying the predicate, searching
+// on up to `threadCount` threads, or one per processor if `threadCount` is
+// zero.  Threads search segments in list order, and stop as soon as a match
+// is found before the nodes they are searching, so the lowest matching index
+// is returned without searching the rest of the list.  The predicate is
+// called from several threads at once, and may be called for elements after
+// the match.  Returns the size of the list if no element matches.
+size_t linked_list_parallel_find_first(IntegerLinkedList *list, LinkedListPredicate const predicate,
+                                       void *context, size_t const threadCount)
 {
-    // Store a pointer to the first node in the list.
-    IntegerNode *node = list->head;
+    if (list->size == 0) { return 0; }
 
-    // Print the number of elements in the list with appropriate grammar.
-    if (list->size == 1)
-    {
-        printf("List contains %zu element.\n", list->size);
-    }
-    else
-    {
-        printf("List contains %zu elements.\n", list->size);
-    }
+    STATS_BEGIN(list);
 
-    // Print an opening brace, indicating the start of the list elements.
-    printf("{");
+    ParallelJob job;
+    job.list = list;
+    job.task = PARALLEL_TASK_FIND;
+    job.predicate = predicate;
+    job.context = context;
+    internal_run_parallel(&job, threadCount);
 
-    // Iterate through every node in the list.
-    while (node)
-    {
-        // Print the value stored in the current node, preceded by a space.
-        printf(" %d", node->data);
+    size_t const found = atomic_load(&job.found);
 
-        // If there is another node in the list, print a comma to communicate
-        // separate elements of the list.
-        if ((node = node->next)) { printf(","); }
-    }
+    STATS_TRAVERSED(list, found);
+    STATS_END(list, LINKED_LIST_OPERATION_PARALLEL_FIND);
+    return found;
+}
 
-    // Finally, print the closing brace padded by one space and followed by a 
-    // newline to the console to communicate the end of the list.
-    printf(" }\n\n");
+// Returns the index of the first node that contains the desired value if the
+// value exists in the list, otherwise the size of the list is returned, see
+// linked_list_parallel_find_first().
+size_t linked_list_parallel_find_first_index_containing(IntegerLinkedList *list, int const value,
+                                                        size_t const threadCount)
+{
+    return linked_list_parallel_find_first(list, internal_equals, (void *)&value, threadCount);
+}
+
+// Copies the statistics of the list into `stats`.  Returns false, with every
+// statistic zeroed, if the library was built without LINKED_LIST_STATS.
+bool linked_list_stats_snapshot(IntegerLinkedList const *list, LinkedListStats *stats)
+{
+#ifdef LINKED_LIST_STATS
+    *stats = list->stats->totals;
+    return true;
+#else
+    (void)list;
+    memset(stats, 0, sizeof(LinkedListStats));
+    return false;
+#endif
 }
 
+// Zeroes every statistic of the list, does nothing if the library was built
+// without LINKED_LIST_STATS.
+void linked_list_stats_reset(IntegerLinkedList *list)
+{
+#ifdef LINKED_LIST_STATS
+    memset(&list->stats->totals, 0, sizeof(LinkedListStats));
+#else
+    (void)list;
+#endif
+}
\ No newline at end of file
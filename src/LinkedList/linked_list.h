@@ -11,57 +11,249 @@
 #ifndef BACHURSKI_LINKED_LIST_H
 #define BACHURSKI_LINKED_LIST_H
 
+// Include the generic list generator, which IntegerLinkedList is built from.
+#include "generic_linked_list.h"
+
 // Include required stdlib headers.
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdio.h>
 
-// Linked List Handle
+// Defines the members the integer list adds to the generated handle.
+// Contains:
+// - Pointer to a hash index of the values, null unless it is enabled.
+// - Whether that index is enabled lazily and waits for its first lookup.
+// - Pointer to the sum, minimum, maximum and value counts kept up to date,
+//   null unless they are enabled.
+// - Starting nodes of the segments parallel traversals split the list into,
+//   and their number, zero until a parallel traversal computes them.
+// - Pointer to the operation statistics, only when built with LINKED_LIST_STATS.
+#ifdef LINKED_LIST_STATS
+#define INTEGER_LIST_STATS_FIELDS() struct ListStatsState *stats;
+#else
+#define INTEGER_LIST_STATS_FIELDS()
+#endif
+
+#define INTEGER_LIST_FIELDS()                                                                \
+    struct ValueIndex *valueIndex;                                                           \
+    bool valueIndexPending;                                                                  \
+    struct ValueAggregates *aggregates;                                                      \
+    struct ListSegment *segments;                                                            \
+    size_t segmentCount;                                                                     \
+    INTEGER_LIST_STATS_FIELDS()
+
+// Linked List Handle, Node, Iterator and Predicate
+// Declares IntegerLinkedList, IntegerLinkedListNode, IntegerLinkedListIterator
+// and IntegerLinkedListPredicate, see generic_linked_list.h.  The handle holds
+// the ends of the list, its number of elements, its pool, its cursor, the
+// compaction and sorted mode settings, and the members above.  The functions
+// shared with every generated list are defined by DEFINE_LINKED_LIST_WITH_HOOKS
+// in linked_list.c, and listed below along with the rest.
+DECLARE_LINKED_LIST_TYPES(IntegerLinkedList, int, INTEGER_LIST_FIELDS)
+
+// Shorter names for the node, the iterator, and the predicate, deciding
+// whether a value matches, called with the value and the context pointer
+// passed along with the predicate.
+typedef IntegerLinkedListNode IntegerNode;
+typedef IntegerLinkedListIterator IntegerListIterator;
+typedef IntegerLinkedListPredicate LinkedListPredicate;
+
+// Defines the number of buckets in each latency histogram.  Bucket `i` counts
+// calls that took fewer than 2^i nanoseconds but at least 2^(i - 1), the last
+// bucket also counts every slower call.
+#define LINKED_LIST_LATENCY_BUCKETS 32
+
+// Operations which are measured when built with LINKED_LIST_STATS.
+typedef enum LinkedListOperation
+{
+    LINKED_LIST_OPERATION_PUSH_BACK,
+    LINKED_LIST_OPERATION_PUSH_FRONT,
+    LINKED_LIST_OPERATION_POP_BACK,
+    LINKED_LIST_OPERATION_POP_FRONT,
+    LINKED_LIST_OPERATION_REMOVE_AT_INDEX,
+    LINKED_LIST_OPERATION_REMOVE_VALUE,
+    LINKED_LIST_OPERATION_ELEMENT_AT,
+    LINKED_LIST_OPERATION_FIND,
+    LINKED_LIST_OPERATION_CONTAINS,
+    LINKED_LIST_OPERATION_LOAD,
+    LINKED_LIST_OPERATION_OUTPUT,
+    LINKED_LIST_OPERATION_PRINT,
+    LINKED_LIST_OPERATION_CLEAR,
+    LINKED_LIST_OPERATION_COMPACT,
+    LINKED_LIST_OPERATION_PUSH_BACK_ARRAY,
+    LINKED_LIST_OPERATION_PUSH_FRONT_ARRAY,
+    LINKED_LIST_OPERATION_EXPORT,
+    LINKED_LIST_OPERATION_SPLICE,
+    LINKED_LIST_OPERATION_REMOVE_IF,
+    LINKED_LIST_OPERATION_REMOVE_VALUES,
+    LINKED_LIST_OPERATION_SORT,
+    LINKED_LIST_OPERATION_PARALLEL_FOR_EACH,
+    LINKED_LIST_OPERATION_PARALLEL_REDUCE,
+    LINKED_LIST_OPERATION_PARALLEL_FIND,
+    LINKED_LIST_OPERATION_AGGREGATE,
+    LINKED_LIST_OPERATION_COUNT
+} LinkedListOperation;
+
+// Operation Statistics
+// Contains:
+// - Number of calls to the operation.
+// - Number of nodes walked past by those calls.
+// - Total time spent in those calls, in nanoseconds.
+// - Histogram of the latency of each call.
+typedef struct LinkedListOperationStats
+{
+    unsigned long long calls;
+    unsigned long long nodesTraversed;
+    unsigned long long totalNanoseconds;
+    unsigned long long latency[LINKED_LIST_LATENCY_BUCKETS];
+} LinkedListOperationStats;
+
+// List Statistics
 // Contains:
-// - Pointer to the beginning of the list.
-// - Pointer to the end of the list.
-// - Number of elements in the list.
-typedef struct IntegerLinkedList
+// - Statistics of each operation, indexed by LinkedListOperation.
+// - Number of nodes taken from and returned to the pool.
+// - Number of slabs allocated and freed by the pool, and their size in bytes.
+typedef struct LinkedListStats
+{
+    LinkedListOperationStats operations[LINKED_LIST_OPERATION_COUNT];
+    unsigned long long nodesAcquired;
+    unsigned long long nodesReleased;
+    unsigned long long slabAllocations;
+    unsigned long long slabFrees;
+    unsigned long long bytesAllocated;
+    unsigned long long bytesFreed;
+} LinkedListStats;
+
+// Outcome of saving or loading a list in the binary format.
+typedef enum LinkedListBinaryStatus
 {
-    struct IntegerNode *head;
-    struct IntegerNode *tail;
-    size_t size;
-} IntegerLinkedList;
+    LINKED_LIST_BINARY_OK,
+    LINKED_LIST_BINARY_OPEN_FAILED,
+    LINKED_LIST_BINARY_WRITE_FAILED,
+    LINKED_LIST_BINARY_NOT_BINARY_LIST,
+    LINKED_LIST_BINARY_UNSUPPORTED_VERSION,
+    LINKED_LIST_BINARY_TRUNCATED,
+    LINKED_LIST_BINARY_CHECKSUM_MISMATCH
+} LinkedListBinaryStatus;
+
+// Function applied to every element by linked_list_parallel_for_each(), which
+// may change the element through `value`.
+typedef void (*LinkedListVisitor)(int *value, void *context);
+
+// Function folding an element, or the result of another part of the list,
+// into a running result for linked_list_parallel_reduce().
+typedef long long (*LinkedListReducer)(long long const accumulator, long long const value,
+                                       void *context);
 
 /*
     * Descriptive comments for the remaining declarations in this file are
-    * included with the definition in the accompanying linked_list.c file.
+    * included with the definition in the accompanying linked_list.c file, or
+    * in generic_linked_list.h for the functions every generated list shares.
     * Comments only serve to separate declarations by their general purpose.
 */
 
 // Initialization
 bool linked_list_initialize(IntegerLinkedList *list);
 void linked_list_load_data_from_file(IntegerLinkedList *list, char const *fileName);
+bool linked_list_load_data_with_report(IntegerLinkedList *list, char const *fileName,
+                                       LinkedListLoadReport *report);
+bool linked_list_load_data_parallel(IntegerLinkedList *list, char const *fileName,
+                                    size_t const threadCount, LinkedListLoadReport *report);
 
 // Cleanup
 void linked_list_cleanup(IntegerLinkedList *list);
+void linked_list_trim(IntegerLinkedList *list);
+void linked_list_compact(IntegerLinkedList *list);
+void linked_list_set_auto_compact(IntegerLinkedList *list, bool const enabled);
 
 // Modifiers
 void linked_list_clear(IntegerLinkedList *list);
 void linked_list_push_back(IntegerLinkedList *list, int const value);
 void linked_list_push_front(IntegerLinkedList *list, int const value);
+void linked_list_push_back_array(IntegerLinkedList *list, int const *values,
+                                 size_t const count);
+void linked_list_push_front_array(IntegerLinkedList *list, int const *values,
+                                  size_t const count);
 void linked_list_pop_back(IntegerLinkedList *list);
 void linked_list_pop_front(IntegerLinkedList *list);
 void linked_list_remove_at_index(IntegerLinkedList *list, size_t const index);
 void linked_list_remove_value(IntegerLinkedList *list, int const value);
+size_t linked_list_remove_if(IntegerLinkedList *list, LinkedListPredicate const predicate,
+                             void *context);
+size_t linked_list_remove_values(IntegerLinkedList *list, int const *values,
+                                 size_t const count);
+
+// Splicing
+void linked_list_splice(IntegerLinkedList *destination, size_t const position,
+                        IntegerLinkedList *source, size_t const first, size_t const count);
+void linked_list_concat(IntegerLinkedList *destination, IntegerLinkedList *source);
+void linked_list_split(IntegerLinkedList *list, size_t const index, IntegerLinkedList *tail);
+
+// Ordering
+void linked_list_sort(IntegerLinkedList *list);
+void linked_list_set_sorted(IntegerLinkedList *list, bool const enabled);
+
+// Parallel Traversal
+void linked_list_parallel_for_each(IntegerLinkedList *list, LinkedListVisitor const visitor,
+                                   void *context, size_t const threadCount);
+long long linked_list_parallel_reduce(IntegerLinkedList *list, LinkedListReducer const reducer,
+                                      long long const identity, void *context,
+                                      size_t const threadCount);
+long long linked_list_parallel_sum(IntegerLinkedList *list, size_t const threadCount);
+size_t linked_list_parallel_count_if(IntegerLinkedList *list, LinkedListPredicate const predicate,
+                                     void *context, size_t const threadCount);
+size_t linked_list_parallel_find_first(IntegerLinkedList *list, LinkedListPredicate const predicate,
+                                       void *context, size_t const threadCount);
+size_t linked_list_parallel_find_first_index_containing(IntegerLinkedList *list, int const value,
+                                                        size_t const threadCount);
 
 // Element Access
 int linked_list_back(IntegerLinkedList const *list);
 int linked_list_front(IntegerLinkedList const *list);
 int linked_list_element_at(IntegerLinkedList const *list, size_t const index);
+size_t linked_list_export_array(IntegerLinkedList const *list, int *values,
+                                size_t const capacity);
+
+// Iteration
+IntegerListIterator linked_list_iterator_first(IntegerLinkedList const *list);
+IntegerListIterator linked_list_iterator_last(IntegerLinkedList const *list);
+IntegerListIterator linked_list_iterator_at(IntegerLinkedList const *list, size_t const index);
+bool linked_list_iterator_valid(IntegerListIterator const *iterator);
+int linked_list_iterator_value(IntegerListIterator const *iterator);
+int *linked_list_iterator_element(IntegerListIterator const *iterator);
+void linked_list_iterator_next(IntegerListIterator *iterator);
+void linked_list_iterator_previous(IntegerListIterator *iterator);
 
 // Output
 void linked_list_output_to_file(IntegerLinkedList *list, char const *fileName);
 
+// Binary Files
+LinkedListBinaryStatus linked_list_save_binary(IntegerLinkedList *list, char const *fileName);
+LinkedListBinaryStatus linked_list_load_binary(IntegerLinkedList *list, char const *fileName);
+
 // Search
 size_t linked_list_find_first_index_containing(IntegerLinkedList const *list, int const value);
+bool linked_list_contains(IntegerLinkedList const *list, int const value);
+void linked_list_enable_value_index(IntegerLinkedList *list);
+void linked_list_enable_lazy_value_index(IntegerLinkedList *list);
+void linked_list_disable_value_index(IntegerLinkedList *list);
+
+// Aggregates
+long long linked_list_sum(IntegerLinkedList const *list);
+bool linked_list_minimum(IntegerLinkedList const *list, int *value);
+bool linked_list_maximum(IntegerLinkedList const *list, int *value);
+size_t linked_list_count_value(IntegerLinkedList const *list, int const value);
+void linked_list_enable_aggregates(IntegerLinkedList *list);
+void linked_list_disable_aggregates(IntegerLinkedList *list);
 
 // Display
 void linked_list_print_list(IntegerLinkedList const *list);
+void linked_list_print_list_page(IntegerLinkedList const *list, size_t const first,
+                                 size_t const count);
+
+// Statistics
+bool linked_list_stats_snapshot(IntegerLinkedList const *list, LinkedListStats *stats);
+void linked_list_stats_reset(IntegerLinkedList *list);
 
 // End of header guard.
 #endif
@@ -0,0 +1,100 @@
+/*
+* File Name: list_stats.c
+* Purpose: Contains function definitions for the operation statistics my
+*          linked list implementation keeps when built with LINKED_LIST_STATS.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Request the POSIX declarations, which strict ISO C builds hide.  This has to
+// come before the first header is included.
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+// Include the header for the list statistics.
+#include "list_stats.h"
+
+// Include required stdlib headers.
+#include <stdlib.h>
+
+// Include the platform headers which provide a monotonic clock.
+// Conditional compilation for Windows environment.
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+// Conditional compilation for Unix environment.
+#else
+#include <time.h>
+// End conditional compilation.
+#endif
+
+// Internal function that returns a monotonic timestamp in nanoseconds.
+static unsigned long long internal_now(void)
+{
+// Conditional compilation for Windows environment.
+#if defined(_WIN32) || defined(_WIN64)
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (unsigned long long)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+// Conditional compilation for Unix environment.
+#else
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (unsigned long long)time.tv_sec * 1000000000ULL + (unsigned long long)time.tv_nsec;
+// End conditional compilation.
+#endif
+}
+
+// Internal function that returns the histogram bucket of a latency, which is
+// the number of significant bits of the nanoseconds, capped at the last bucket.
+static size_t internal_latency_bucket(unsigned long long nanoseconds)
+{
+    size_t bucket = 0;
+    while (nanoseconds && bucket < LINKED_LIST_LATENCY_BUCKETS - 1)
+    {
+        nanoseconds >>= 1;
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+// Creates zeroed statistics.  Returns null if allocation fails.
+ListStatsState *list_stats_create(void)
+{
+    return (ListStatsState *)calloc(1, sizeof(ListStatsState));
+}
+
+// Releases statistics created by list_stats_create().
+void list_stats_destroy(ListStatsState *state)
+{
+    free(state);
+}
+
+// Starts measuring a call.  Nodes walked past by an enclosing call are put
+// aside so that each call is only charged for its own traversal.
+ListStatsTimer list_stats_begin(ListStatsState *state)
+{
+    ListStatsTimer timer = { internal_now(), state->pendingTraversed };
+    state->pendingTraversed = 0;
+    return timer;
+}
+
+// Finishes measuring a call, adding it to the statistics of `operation`.
+void list_stats_end(ListStatsState *state, LinkedListOperation const operation,
+                    ListStatsTimer const *timer)
+{
+    unsigned long long const elapsed = internal_now() - timer->start;
+    LinkedListOperationStats *stats = &state->totals.operations[operation];
+
+    ++stats->calls;
+    stats->nodesTraversed += state->pendingTraversed;
+    stats->totalNanoseconds += elapsed;
+    ++stats->latency[internal_latency_bucket(elapsed)];
+
+    // Hand the enclosing call back the traversal it had before this call.
+    state->pendingTraversed = timer->outerTraversed;
+}
@@ -0,0 +1,53 @@
+/*
+* File Name: list_stats.h
+* Purpose: Contains the private types and function declarations used by my
+*          linked list implementation to measure its operations when built
+*          with LINKED_LIST_STATS.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_LIST_STATS_H
+#define BACHURSKI_LIST_STATS_H
+
+// Include the header for the public statistics types.
+#include "linked_list.h"
+
+// Definition for the statistics kept by a list.
+// Contains:
+// - Totals reported by linked_list_stats_snapshot().
+// - Nodes walked past by the operation currently being measured.
+typedef struct ListStatsState
+{
+    LinkedListStats totals;
+    unsigned long long pendingTraversed;
+} ListStatsState;
+
+// Definition for the measurement of a single call.
+// Contains:
+// - Time the call started, in nanoseconds.
+// - Nodes walked past by an enclosing call before this one started.
+typedef struct ListStatsTimer
+{
+    unsigned long long start;
+    unsigned long long outerTraversed;
+} ListStatsTimer;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying list_stats.c file.
+*/
+
+// Lifetime
+ListStatsState *list_stats_create(void);
+void list_stats_destroy(ListStatsState *state);
+
+// Measurement
+ListStatsTimer list_stats_begin(ListStatsState *state);
+void list_stats_end(ListStatsState *state, LinkedListOperation const operation,
+                    ListStatsTimer const *timer);
+
+// End of header guard.
+#endif
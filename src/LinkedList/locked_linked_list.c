@@ -0,0 +1,293 @@
+/*
+* File Name: locked_linked_list.c
+* Purpose: Contains function definitions for the thread-safe variant of my
+*          linked list implementation.
+*
+*          Every node carries its own mutex, and every walk through the list
+*          locks hand over hand: the next node is locked before the current
+*          one is unlocked.  A thread therefore only ever holds two adjacent
+*          nodes, always locked in list order so threads cannot deadlock, and
+*          threads working further along the list are never blocked.  Holding
+*          a node's predecessor is what allows a thread to lock the node, so
+*          a thread holding both may unlink and free the node knowing no other
+*          thread can be waiting for it.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Include the header for the locked list.
+#include "locked_linked_list.h"
+
+// Include required stdlib headers.
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Internal function that prints a diagnostic message and aborts the program if
+// a call to malloc returns a null pointer, or a mutex cannot be created.
+static void internal_bad_alloc(void)
+{
+    fprintf(stderr, "Memory allocation failed!\n");
+    abort();
+}
+
+// Internal function that allocates a node storing `value`.
+static LockedNode *internal_create_node(int const value)
+{
+    LockedNode *node = malloc(sizeof(LockedNode));
+
+    if (!node) { internal_bad_alloc(); }
+
+    if (!platform_mutex_initialize(&node->mutex))
+    {
+        free(node);
+        internal_bad_alloc();
+    }
+
+    node->next = NULL;
+    node->data = value;
+    return node;
+}
+
+// Internal function that frees a node no other thread can reach.
+static void internal_destroy_node(LockedNode *node)
+{
+    platform_mutex_cleanup(&node->mutex);
+    free(node);
+}
+
+// Internal function that moves from the locked node `previous` to the node
+// following it, locking the following node before unlocking `previous`.
+// Returns the following node, now locked, or null with `previous` still locked
+// if it is the last node.
+static LockedNode *internal_advance(LockedNode *previous)
+{
+    LockedNode *current = previous->next;
+
+    if (!current) { return NULL; }
+
+    platform_mutex_lock(&current->mutex);
+    platform_mutex_unlock(&previous->mutex);
+    return current;
+}
+
+// Internal function that unlinks and frees the locked node `current`, which
+// follows the locked node `previous`.  `previous` remains locked.
+static void internal_unlink(LockedIntegerList *list, LockedNode *previous, LockedNode *current)
+{
+    previous->next = current->next;
+    platform_mutex_unlock(&current->mutex);
+    internal_destroy_node(current);
+    atomic_fetch_sub(&list->size, 1);
+}
+
+// Initializes an empty list.  Returns false if the mutex of the sentinel
+// cannot be created.
+bool locked_list_initialize(LockedIntegerList *list)
+{
+    list->head.next = NULL;
+    list->head.data = 0;
+    atomic_init(&list->size, 0);
+    return platform_mutex_initialize(&list->head.mutex);
+}
+
+// Frees every node in the list.  No other thread may use the list.
+void locked_list_cleanup(LockedIntegerList *list)
+{
+    LockedNode *node = list->head.next;
+
+    while (node)
+    {
+        LockedNode *next = node->next;
+        internal_destroy_node(node);
+        node = next;
+    }
+
+    list->head.next = NULL;
+    atomic_store(&list->size, 0);
+    platform_mutex_cleanup(&list->head.mutex);
+}
+
+// Adds a node with the specified value to the back of the list.  Without a
+// tail pointer, which would need a lock of its own every thread appends
+// through, the list is walked to its end.
+void locked_list_push_back(LockedIntegerList *list, int const value)
+{
+    LockedNode *node = internal_create_node(value);
+    LockedNode *last = &list->head;
+
+    platform_mutex_lock(&last->mutex);
+
+    for (LockedNode *next = internal_advance(last); next; next = internal_advance(last))
+    {
+        last = next;
+    }
+
+    last->next = node;
+    atomic_fetch_add(&list->size, 1);
+    platform_mutex_unlock(&last->mutex);
+}
+
+// Adds a node with the specified value to the front of the list.
+void locked_list_push_front(LockedIntegerList *list, int const value)
+{
+    LockedNode *node = internal_create_node(value);
+
+    platform_mutex_lock(&list->head.mutex);
+    node->next = list->head.next;
+    list->head.next = node;
+    atomic_fetch_add(&list->size, 1);
+    platform_mutex_unlock(&list->head.mutex);
+}
+
+// Removes the first node in the list, storing its value in `value`.  Returns
+// false if the list is empty.
+bool locked_list_pop_front(LockedIntegerList *list, int *value)
+{
+    platform_mutex_lock(&list->head.mutex);
+
+    LockedNode *first = list->head.next;
+
+    if (!first)
+    {
+        platform_mutex_unlock(&list->head.mutex);
+        return false;
+    }
+
+    platform_mutex_lock(&first->mutex);
+    *value = first->data;
+    internal_unlink(list, &list->head, first);
+    platform_mutex_unlock(&list->head.mutex);
+    return true;
+}
+
+// Removes the node at the specified index.  Other threads may shrink the list
+// at any time, so an index past the end is not an error.  Returns false if
+// there is no node at the index.
+bool locked_list_remove_at_index(LockedIntegerList *list, size_t const index)
+{
+    LockedNode *previous = &list->head;
+    platform_mutex_lock(&previous->mutex);
+
+    // Walk to the node ahead of the index.
+    for (size_t i = 0; i < index; ++i)
+    {
+        LockedNode *next = internal_advance(previous);
+
+        if (!next)
+        {
+            platform_mutex_unlock(&previous->mutex);
+            return false;
+        }
+
+        previous = next;
+    }
+
+    LockedNode *current = previous->next;
+
+    if (current)
+    {
+        platform_mutex_lock(&current->mutex);
+        internal_unlink(list, previous, current);
+    }
+
+    platform_mutex_unlock(&previous->mutex);
+    return current != NULL;
+}
+
+// Removes all nodes from the list that contain the specified value.  Returns
+// the number of nodes removed.
+size_t locked_list_remove_value(LockedIntegerList *list, int const value)
+{
+    LockedNode *previous = &list->head;
+    size_t removed = 0;
+
+    platform_mutex_lock(&previous->mutex);
+
+    for (LockedNode *current = previous->next; current; current = previous->next)
+    {
+        platform_mutex_lock(&current->mutex);
+
+        // Unlink a match while holding its predecessor, which stays locked
+        // for the node that follows.
+        if (current->data == value)
+        {
+            internal_unlink(list, previous, current);
+            ++removed;
+            continue;
+        }
+
+        platform_mutex_unlock(&previous->mutex);
+        previous = current;
+    }
+
+    platform_mutex_unlock(&previous->mutex);
+    return removed;
+}
+
+// Stores the value at the specified index in `value`.  Returns false if there
+// is no node at the index.
+bool locked_list_element_at(LockedIntegerList *list, size_t const index, int *value)
+{
+    LockedNode *current = &list->head;
+    platform_mutex_lock(&current->mutex);
+
+    // The sentinel is one step ahead of index zero.
+    for (size_t i = 0; i <= index; ++i)
+    {
+        LockedNode *next = internal_advance(current);
+
+        if (!next)
+        {
+            platform_mutex_unlock(&current->mutex);
+            return false;
+        }
+
+        current = next;
+    }
+
+    *value = current->data;
+    platform_mutex_unlock(&current->mutex);
+    return true;
+}
+
+// Returns the number of nodes in the list at the moment it was checked.
+size_t locked_list_size(LockedIntegerList const *list)
+{
+    return atomic_load(&list->size);
+}
+
+// Returns the index of the first node that contains the desired value if the
+// value exists in the list, otherwise LOCKED_LIST_NOT_FOUND is returned.
+size_t locked_list_find_first_index_containing(LockedIntegerList *list, int const value)
+{
+    LockedNode *current = &list->head;
+    platform_mutex_lock(&current->mutex);
+
+    for (size_t index = 0;; ++index)
+    {
+        LockedNode *next = internal_advance(current);
+
+        if (!next) { break; }
+
+        current = next;
+
+        if (current->data == value)
+        {
+            platform_mutex_unlock(&current->mutex);
+            return index;
+        }
+    }
+
+    platform_mutex_unlock(&current->mutex);
+    return LOCKED_LIST_NOT_FOUND;
+}
+
+// Returns true if the list contains the specified value.
+bool locked_list_contains(LockedIntegerList *list, int const value)
+{
+    return locked_list_find_first_index_containing(list, value) != LOCKED_LIST_NOT_FOUND;
+}
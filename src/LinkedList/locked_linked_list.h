@@ -0,0 +1,80 @@
+/*
+* File Name: locked_linked_list.h
+* Purpose: Contains the structure definitions and function declarations for
+*          the thread-safe variant of my linked list implementation, which
+*          locks individual nodes so that threads working on different parts
+*          of the list do not wait for each other.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_LOCKED_LINKED_LIST_H
+#define BACHURSKI_LOCKED_LINKED_LIST_H
+
+// Include the header for the mutex guarding every node.
+#include "platform_thread.h"
+
+// Include required stdlib headers.
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Defines the index returned by locked_list_find_first_index_containing()
+// when the value is not in the list.  The size of the list can change during
+// the search, so it cannot serve as the "not found" index.
+#define LOCKED_LIST_NOT_FOUND SIZE_MAX
+
+// Definition for a locked list node.
+// Contains:
+// - Pointer to the `next` node.
+// - Mutex guarding the `next` pointer and the value of the node.
+// - Integer value being stored.
+typedef struct LockedNode
+{
+    struct LockedNode *next;
+    PlatformMutex mutex;
+    int data;
+} LockedNode;
+
+// Definition for a locked list.
+// Contains:
+// - Sentinel node ahead of the first node, its mutex guards the first link.
+// - Number of nodes in the list, updated as nodes are linked and unlinked.
+typedef struct LockedIntegerList
+{
+    LockedNode head;
+    _Atomic size_t size;
+} LockedIntegerList;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying locked_linked_list.c
+    * file.
+*/
+
+// Lifetime
+bool locked_list_initialize(LockedIntegerList *list);
+void locked_list_cleanup(LockedIntegerList *list);
+
+// Adding Elements
+void locked_list_push_back(LockedIntegerList *list, int const value);
+void locked_list_push_front(LockedIntegerList *list, int const value);
+
+// Removing Elements
+bool locked_list_pop_front(LockedIntegerList *list, int *value);
+bool locked_list_remove_at_index(LockedIntegerList *list, size_t const index);
+size_t locked_list_remove_value(LockedIntegerList *list, int const value);
+
+// Accessing Elements
+bool locked_list_element_at(LockedIntegerList *list, size_t const index, int *value);
+size_t locked_list_size(LockedIntegerList const *list);
+
+// Searching
+size_t locked_list_find_first_index_containing(LockedIntegerList *list, int const value);
+bool locked_list_contains(LockedIntegerList *list, int const value);
+
+// End of header guard.
+#endif
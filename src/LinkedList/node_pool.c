@@ -0,0 +1,373 @@
+/*
+* File Name: node_pool.c
+* Purpose: Contains constants and function definitions for the slab
+*          allocator that backs every node of my linked list implementation.
+*
+*          A pool hands out nodes of one size, set when it is created, so the
+*          same allocator serves lists of any element type.  A released node
+*          is linked into the free list through the pointer every node starts
+*          with, its `next` pointer.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Include the header for the node pool.
+#include "node_pool.h"
+
+// Include the header for the statistics slabs are counted in.
+#include "linked_list.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Defines a constant for the number of nodes held by the first slab a pool
+// allocates, small lists should not pay for a large slab.
+#define MINIMUM_SLAB_CAPACITY 32
+
+// Defines a constant for the largest number of nodes a single slab may hold,
+// slabs double in size until they reach this limit.
+#define MAXIMUM_SLAB_CAPACITY 4096
+
+// Internal function that returns the size in bytes of a slab of the pool
+// holding `capacity` nodes.
+static size_t internal_slab_bytes(NodePool const *pool, size_t const capacity)
+{
+    return sizeof(NodeSlab) + capacity * pool->nodeSize;
+}
+
+// Internal function that returns the node at `index` of a slab of the pool.
+static void *internal_slab_node(NodePool const *pool, NodeSlab *slab, size_t const index)
+{
+    return (unsigned char *)slab->nodes + index * pool->nodeSize;
+}
+
+// Internal functions that read and write the `next` pointer a node starts
+// with.  The node is accessed as bytes, since its type is only known to the
+// list.
+static void *internal_next(void const *node)
+{
+    void *next;
+    memcpy(&next, node, sizeof(next));
+    return next;
+}
+
+static void internal_set_next(void *node, void *next)
+{
+    memcpy(node, &next, sizeof(next));
+}
+
+// Internal function that allocates a slab able to hold `capacity` nodes for
+// the pool.  Returns null if allocation fails.
+static NodeSlab *internal_allocate_slab(NodePool *pool, size_t const capacity)
+{
+    // Allocate the slab header and its nodes in a single block.
+    NodeSlab *slab = (NodeSlab *)malloc(internal_slab_bytes(pool, capacity));
+
+    // If allocation fails, let the caller decide how to report it.
+    if (!slab) { return NULL; }
+
+#ifdef LINKED_LIST_STATS
+    // Count the allocation if the pool reports to statistics.
+    if (pool->statistics)
+    {
+        ++pool->statistics->slabAllocations;
+        pool->statistics->bytesAllocated += internal_slab_bytes(pool, capacity);
+    }
+#endif
+
+    // A new slab is not linked to any other slab yet.
+    slab->next = NULL;
+    slab->capacity = capacity;
+
+    return slab;
+}
+
+// Internal function that frees a slab of the pool.
+static void internal_free_slab(NodePool *pool, NodeSlab *slab)
+{
+#ifdef LINKED_LIST_STATS
+    // Count the release if the pool reports to statistics.
+    if (pool->statistics)
+    {
+        ++pool->statistics->slabFrees;
+        pool->statistics->bytesFreed += internal_slab_bytes(pool, slab->capacity);
+    }
+#else
+    (void)pool;
+#endif
+
+    free(slab);
+}
+
+// Creates an empty pool of nodes of `nodeSize` bytes, no slabs are allocated
+// until the first node is requested.  The size must be a multiple of the
+// alignment of the nodes, as sizeof() always is, and the nodes must start
+// with their `next` pointer.  Returns null if allocation fails.
+NodePool *node_pool_create(size_t const nodeSize)
+{
+    // Allocate memory for the pool itself.
+    NodePool *pool = (NodePool *)malloc(sizeof(NodePool));
+
+    // If allocation fails, let the caller decide how to report it.
+    if (!pool) { return NULL; }
+
+    // Start with no slabs, no free nodes, and the smallest slab size.
+    pool->nodeSize = nodeSize;
+    pool->firstSlab = NULL;
+    pool->currentSlab = NULL;
+    pool->currentUsed = 0;
+    pool->nextCapacity = MINIMUM_SLAB_CAPACITY;
+    pool->freeList = NULL;
+
+    // The list creating the pool is its only user so far.
+    pool->references = 1;
+
+#ifdef LINKED_LIST_STATS
+    // Slabs are not counted until the owner provides statistics.
+    pool->statistics = NULL;
+#endif
+
+    return pool;
+}
+
+// Releases every slab owned by the pool followed by the pool itself.  Any
+// node acquired from the pool is invalid afterwards.
+void node_pool_destroy(NodePool *pool)
+{
+    // Destroying a null pool is a no-op, mirroring free().
+    if (!pool) { return; }
+
+    // Walk the chain of slabs, storing `next` before each slab is freed.
+    NodeSlab *slab = pool->firstSlab;
+    while (slab)
+    {
+        NodeSlab *next = slab->next;
+        internal_free_slab(pool, slab);
+        slab = next;
+    }
+
+    // Finally free the pool.
+    free(pool);
+}
+
+// Records that one more list allocates its nodes from the pool.  A pool used
+// by several lists cannot be reset, since the nodes of the other lists would
+// be handed out again.
+void node_pool_retain(NodePool *pool)
+{
+    ++pool->references;
+}
+
+// Moves every slab and released node of `other` into `pool`, then frees
+// `other`, which must not be used again.  Both pools must hold nodes of the
+// same size.  Nodes acquired from `other` stay where they are and now belong
+// to `pool`.  The cost depends on the number of
+// slabs and released nodes of `other`, never on the nodes in use.
+void node_pool_absorb(NodePool *pool, NodePool *other)
+{
+    // Slabs of the other pool which hold no nodes are returned to the system
+    // rather than moved, which leaves its current slab last in its chain.
+    node_pool_trim(other);
+
+    if (other->firstSlab)
+    {
+        // Find the last slab of the other pool.
+        NodeSlab *last = other->firstSlab;
+        while (last->next) { last = last->next; }
+
+        // Move the slabs in front of the slabs of this pool, where carving
+        // and trimming never reach them while they hold nodes.
+        last->next = pool->firstSlab;
+        pool->firstSlab = other->firstSlab;
+
+        // A pool without slabs carries on carving where the other pool
+        // stopped, otherwise the rest of the other current slab is left
+        // unused until the pool is reset.
+        if (!pool->currentSlab)
+        {
+            pool->currentSlab = other->currentSlab;
+            pool->currentUsed = other->currentUsed;
+        }
+    }
+
+    // Keep growing slabs from the larger of the two sizes.
+    if (other->nextCapacity > pool->nextCapacity) { pool->nextCapacity = other->nextCapacity; }
+
+    // Append the free list of this pool to the free list of the other pool,
+    // which becomes the combined free list.
+    if (other->freeList)
+    {
+        void *last = other->freeList;
+        while (internal_next(last)) { last = internal_next(last); }
+
+        internal_set_next(last, pool->freeList);
+        pool->freeList = other->freeList;
+    }
+
+    // The slabs now belong to this pool, so only the pool itself is freed.
+    free(other);
+}
+
+// Hands out a node from the pool.  Released nodes are reused first, then
+// nodes are carved from the current slab, and only when every slab is
+// exhausted is a new slab allocated.  Returns null if allocation fails.
+void *node_pool_acquire(NodePool *pool)
+{
+    // Reuse the most recently released node if there is one.
+    if (pool->freeList)
+    {
+        void *node = pool->freeList;
+        pool->freeList = internal_next(node);
+        return node;
+    }
+
+    // If the current slab still has untouched nodes, carve the next one.
+    if (pool->currentSlab && pool->currentUsed < pool->currentSlab->capacity)
+    {
+        return internal_slab_node(pool, pool->currentSlab, pool->currentUsed++);
+    }
+
+    // If the pool was reset, slabs after the current one are retained and
+    // completely unused, so move on to the next one before allocating.
+    if (pool->currentSlab && pool->currentSlab->next)
+    {
+        pool->currentSlab = pool->currentSlab->next;
+        pool->currentUsed = 1;
+        return internal_slab_node(pool, pool->currentSlab, 0);
+    }
+
+    // Every slab is exhausted, allocate a new one.
+    NodeSlab *slab = internal_allocate_slab(pool, pool->nextCapacity);
+
+    // If allocation fails, let the caller decide how to report it.
+    if (!slab) { return NULL; }
+
+    // Grow the size of the following slab, up to the maximum.
+    if (pool->nextCapacity < MAXIMUM_SLAB_CAPACITY) { pool->nextCapacity *= 2; }
+
+    // Append the slab after the current one, which is always the last slab
+    // at this point, or make it the first slab if the pool is empty.
+    if (pool->currentSlab)
+    {
+        pool->currentSlab->next = slab;
+    }
+    else
+    {
+        pool->firstSlab = slab;
+    }
+
+    // Carve the first node from the new slab.
+    pool->currentSlab = slab;
+    pool->currentUsed = 1;
+    return internal_slab_node(pool, slab, 0);
+}
+
+// Hands out `count` nodes stored next to each other in memory, returning a
+// pointer to the first of them.  The block is carved from the current slab if
+// it has room, otherwise a slab large enough for the block is inserted after
+// the current slab.  Returns null if allocation fails.
+void *node_pool_acquire_block(NodePool *pool, size_t const count)
+{
+    // Carve the block from the current slab if it fits.
+    if (pool->currentSlab && pool->currentSlab->capacity - pool->currentUsed >= count)
+    {
+        void *block = internal_slab_node(pool, pool->currentSlab, pool->currentUsed);
+        pool->currentUsed += count;
+        return block;
+    }
+
+    // Otherwise allocate a slab holding at least the whole block.
+    size_t const capacity = count > pool->nextCapacity ? count : pool->nextCapacity;
+    NodeSlab *slab = internal_allocate_slab(pool, capacity);
+
+    // If allocation fails, let the caller decide how to report it.
+    if (!slab) { return NULL; }
+
+    // Insert the slab after the current one, ahead of any slabs retained by
+    // a reset, and carve the block from its start.
+    if (pool->currentSlab)
+    {
+        slab->next = pool->currentSlab->next;
+        pool->currentSlab->next = slab;
+    }
+    else
+    {
+        slab->next = pool->firstSlab;
+        pool->firstSlab = slab;
+    }
+
+    pool->currentSlab = slab;
+    pool->currentUsed = count;
+    return internal_slab_node(pool, slab, 0);
+}
+
+// Returns a node to the pool so that it can be handed out again.
+void node_pool_release(NodePool *pool, void *node)
+{
+    // Push the node onto the free list, reusing `next` as the link.
+    internal_set_next(node, pool->freeList);
+    pool->freeList = node;
+}
+
+// Returns every node to the pool at once without visiting them.  Slabs are
+// retained for reuse, call node_pool_trim() to return them to the system.
+void node_pool_reset(NodePool *pool)
+{
+    // Forget about released nodes, they are part of the slabs being rewound.
+    pool->freeList = NULL;
+
+    // Rewind carving to the start of the first slab.
+    pool->currentSlab = pool->firstSlab;
+    pool->currentUsed = 0;
+}
+
+// Returns slabs which hold no nodes in use back to the system.  These are the
+// slabs after the current one, plus the current slab itself if nothing has
+// been carved from it since the last reset.
+void node_pool_trim(NodePool *pool)
+{
+    // A pool without slabs has nothing to trim.
+    if (!pool->currentSlab) { return; }
+
+    // Free every slab following the current one, they have not been touched
+    // since the last reset.
+    NodeSlab *slab = pool->currentSlab->next;
+    while (slab)
+    {
+        NodeSlab *next = slab->next;
+        internal_free_slab(pool, slab);
+        slab = next;
+    }
+    pool->currentSlab->next = NULL;
+
+    // If nodes were carved from the current slab it has to stay.
+    if (pool->currentUsed > 0) { return; }
+
+    // Otherwise find the slab before the current one so it can be unlinked.
+    NodeSlab *previous = NULL;
+    for (slab = pool->firstSlab; slab != pool->currentSlab; slab = slab->next)
+    {
+        previous = slab;
+    }
+
+    // Free the unused slab and step back to the previous slab, which was
+    // filled before carving moved on.
+    internal_free_slab(pool, pool->currentSlab);
+    if (previous)
+    {
+        previous->next = NULL;
+        pool->currentSlab = previous;
+        pool->currentUsed = previous->capacity;
+    }
+    else
+    {
+        pool->firstSlab = NULL;
+        pool->currentSlab = NULL;
+        pool->currentUsed = 0;
+        pool->nextCapacity = MINIMUM_SLAB_CAPACITY;
+    }
+}
@@ -0,0 +1,76 @@
+/*
+* File Name: node_pool.h
+* Purpose: Contains the private slab allocator used by my linked list
+*          implementation to allocate its nodes.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_NODE_POOL_H
+#define BACHURSKI_NODE_POOL_H
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+
+// Definition for a slab, a single allocation holding many nodes.
+// Contains:
+// - Pointer to the `next` slab owned by the pool.
+// - Number of nodes the slab can hold.
+// - The nodes themselves, stored contiguously and aligned for any type.
+typedef struct NodeSlab
+{
+    struct NodeSlab *next;
+    size_t capacity;
+    max_align_t nodes[];
+} NodeSlab;
+
+// Definition for a node pool.  Every node of a pool has the same size, and
+// starts with the pointer to the `next` node, which links released nodes.
+// Contains:
+// - Size of each node in bytes.
+// - Pointer to the first slab owned by the pool.
+// - Pointer to the slab new nodes are currently carved from.
+// - Number of nodes already carved from the current slab.
+// - Capacity used for the next slab that has to be allocated.
+// - Intrusive list of released nodes, linked through their `next` pointer.
+// - Number of lists allocating their nodes from the pool.
+// - Statistics to count slabs in, only when built with LINKED_LIST_STATS.
+typedef struct NodePool
+{
+    size_t nodeSize;
+    NodeSlab *firstSlab;
+    NodeSlab *currentSlab;
+    size_t currentUsed;
+    size_t nextCapacity;
+    void *freeList;
+    size_t references;
+#ifdef LINKED_LIST_STATS
+    struct LinkedListStats *statistics;
+#endif
+} NodePool;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying node_pool.c file.
+*/
+
+// Lifetime
+NodePool *node_pool_create(size_t const nodeSize);
+void node_pool_destroy(NodePool *pool);
+void node_pool_retain(NodePool *pool);
+void node_pool_absorb(NodePool *pool, NodePool *other);
+
+// Allocation
+void *node_pool_acquire(NodePool *pool);
+void *node_pool_acquire_block(NodePool *pool, size_t const count);
+void node_pool_release(NodePool *pool, void *node);
+
+// Bulk Operations
+void node_pool_reset(NodePool *pool);
+void node_pool_trim(NodePool *pool);
+
+// End of header guard.
+#endif
@@ -0,0 +1,210 @@
+/*
+* File Name: output_buffer.c
+* Purpose: Contains constants and function definitions for the buffered
+*          formatter shared by the output and display functions of my linked
+*          list implementations.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Include the header for the output buffer.
+#include "output_buffer.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Defines a constant for the size of the text buffer, large enough that even
+// huge lists are written with few calls into the system.
+#define OUTPUT_BUFFER_CAPACITY 65536
+
+// Defines a constant for the most characters a single number can take, enough
+// for a 64-bit size plus a sign and separator.
+#define MAXIMUM_NUMBER_LENGTH 24
+
+// Table holding the two characters of every number from 00 to 99, used to
+// convert numbers to text two digits at a time.
+static char const DIGIT_PAIRS[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Internal function that writes the buffered text to the stream and empties
+// the buffer.
+static void internal_flush(OutputBuffer *buffer)
+{
+    // Nothing buffered, nothing to write.
+    if (buffer->length == 0) { return; }
+
+    // Remember a short write, the caller reports it when the buffer closes.
+    if (fwrite(buffer->data, 1, buffer->length, buffer->stream) != buffer->length)
+    {
+        buffer->failed = true;
+    }
+
+    buffer->length = 0;
+}
+
+// Internal function that guarantees room for `needed` more characters.
+static void internal_reserve(OutputBuffer *buffer, size_t const needed)
+{
+    if (OUTPUT_BUFFER_CAPACITY - buffer->length < needed) { internal_flush(buffer); }
+}
+
+// Internal function that writes the digits of `value` ending just before
+// `end`, returning a pointer to the first digit written.
+static char *internal_format_digits(char *end, unsigned long long value)
+{
+    // Emit two digits per division while at least two remain.
+    while (value >= 100)
+    {
+        unsigned const pair = (unsigned)(value % 100) * 2;
+        value /= 100;
+        *--end = DIGIT_PAIRS[pair + 1];
+        *--end = DIGIT_PAIRS[pair];
+    }
+
+    // Emit the final one or two digits.
+    if (value >= 10)
+    {
+        unsigned const pair = (unsigned)value * 2;
+        *--end = DIGIT_PAIRS[pair + 1];
+        *--end = DIGIT_PAIRS[pair];
+    }
+    else
+    {
+        *--end = (char)('0' + value);
+    }
+
+    return end;
+}
+
+// Prepares a buffer that writes to `stream`.  Returns false if the text
+// buffer cannot be allocated.
+bool output_buffer_open(OutputBuffer *buffer, FILE *stream)
+{
+    buffer->stream = stream;
+    buffer->length = 0;
+    buffer->elementCount = 0;
+    buffer->failed = false;
+
+    // Allocate the text buffer, letting the caller report a failure.
+    buffer->data = (char *)malloc(OUTPUT_BUFFER_CAPACITY);
+    return buffer->data != NULL;
+}
+
+// Writes any remaining text and releases the text buffer.  Returns false if
+// any write to the stream failed.
+bool output_buffer_close(OutputBuffer *buffer)
+{
+    internal_flush(buffer);
+
+    free(buffer->data);
+    buffer->data = NULL;
+
+    return !buffer->failed;
+}
+
+// Appends a null terminated string to the buffer.
+void output_buffer_append_text(OutputBuffer *buffer, char const *text)
+{
+    size_t remaining = strlen(text);
+
+    // Copy the text in pieces no larger than the buffer.
+    while (remaining > 0)
+    {
+        if (buffer->length == OUTPUT_BUFFER_CAPACITY) { internal_flush(buffer); }
+
+        size_t chunk = OUTPUT_BUFFER_CAPACITY - buffer->length;
+        if (chunk > remaining) { chunk = remaining; }
+
+        memcpy(buffer->data + buffer->length, text, chunk);
+        buffer->length += chunk;
+        text += chunk;
+        remaining -= chunk;
+    }
+}
+
+// Appends the decimal text of an integer, identical to printf("%d").
+void output_buffer_append_int(OutputBuffer *buffer, int const value)
+{
+    output_buffer_append_long_long(buffer, value);
+}
+
+// Appends the decimal text of a long long, identical to printf("%lld").
+void output_buffer_append_long_long(OutputBuffer *buffer, long long const value)
+{
+    internal_reserve(buffer, MAXIMUM_NUMBER_LENGTH);
+
+    // Format into a scratch area, working on the magnitude as an unsigned
+    // value so that the most negative integer does not overflow.
+    char scratch[MAXIMUM_NUMBER_LENGTH];
+    char *end = scratch + MAXIMUM_NUMBER_LENGTH;
+    unsigned long long magnitude = value < 0 ? 0ULL - (unsigned long long)value
+                                             : (unsigned long long)value;
+    char *start = internal_format_digits(end, magnitude);
+    if (value < 0) { *--start = '-'; }
+
+    // Copy the digits into the buffer.
+    memcpy(buffer->data + buffer->length, start, (size_t)(end - start));
+    buffer->length += (size_t)(end - start);
+}
+
+// Appends the decimal text of a size, identical to printf("%zu").
+void output_buffer_append_size(OutputBuffer *buffer, size_t const value)
+{
+    internal_reserve(buffer, MAXIMUM_NUMBER_LENGTH);
+
+    char scratch[MAXIMUM_NUMBER_LENGTH];
+    char *end = scratch + MAXIMUM_NUMBER_LENGTH;
+    char *start = internal_format_digits(end, (unsigned long long)value);
+
+    memcpy(buffer->data + buffer->length, start, (size_t)(end - start));
+    buffer->length += (size_t)(end - start);
+}
+
+// Appends the line stating the number of elements in the list, with
+// appropriate grammar, followed by the opening brace of the elements.
+void output_buffer_begin_list(OutputBuffer *buffer, size_t const size)
+{
+    output_buffer_append_text(buffer, "List contains ");
+    output_buffer_append_size(buffer, size);
+    output_buffer_append_text(buffer, size == 1 ? " element.\n{" : " elements.\n{");
+
+    buffer->elementCount = 0;
+}
+
+// Appends what precedes an element of the list, a comma if it is not the
+// first element, and a space.  The element itself follows in any format.
+void output_buffer_begin_element(OutputBuffer *buffer)
+{
+    internal_reserve(buffer, 2);
+
+    if (buffer->elementCount++ > 0) { buffer->data[buffer->length++] = ','; }
+    buffer->data[buffer->length++] = ' ';
+}
+
+// Appends a single integer element of the list, preceded by a comma if it is
+// not the first element, and a space.
+void output_buffer_append_element(OutputBuffer *buffer, int const value)
+{
+    output_buffer_begin_element(buffer);
+    output_buffer_append_int(buffer, value);
+}
+
+// Appends the closing brace padded by one space and followed by a blank line.
+void output_buffer_end_list(OutputBuffer *buffer)
+{
+    output_buffer_append_text(buffer, " }\n\n");
+}
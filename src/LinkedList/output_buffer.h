@@ -0,0 +1,58 @@
+/*
+* File Name: output_buffer.h
+* Purpose: Contains the private type and function declarations for the
+*          buffered formatter shared by the output and display functions of
+*          my linked list implementations.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_OUTPUT_BUFFER_H
+#define BACHURSKI_OUTPUT_BUFFER_H
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// Buffer that collects formatted text before writing it to a stream.
+// Contains:
+// - Stream the text is written to.
+// - Pointer to the heap allocated text buffer.
+// - Number of characters currently held by the buffer.
+// - Number of list elements appended since the list was opened.
+// - Whether any write to the stream has failed.
+typedef struct OutputBuffer
+{
+    FILE *stream;
+    char *data;
+    size_t length;
+    size_t elementCount;
+    bool failed;
+} OutputBuffer;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying output_buffer.c file.
+*/
+
+// Lifetime
+bool output_buffer_open(OutputBuffer *buffer, FILE *stream);
+bool output_buffer_close(OutputBuffer *buffer);
+
+// Text
+void output_buffer_append_text(OutputBuffer *buffer, char const *text);
+void output_buffer_append_int(OutputBuffer *buffer, int const value);
+void output_buffer_append_long_long(OutputBuffer *buffer, long long const value);
+void output_buffer_append_size(OutputBuffer *buffer, size_t const value);
+
+// List Format
+void output_buffer_begin_list(OutputBuffer *buffer, size_t const size);
+void output_buffer_begin_element(OutputBuffer *buffer);
+void output_buffer_append_element(OutputBuffer *buffer, int const value);
+void output_buffer_end_list(OutputBuffer *buffer);
+
+// End of header guard.
+#endif
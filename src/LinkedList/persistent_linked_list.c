@@ -0,0 +1,540 @@
+/*
+* File Name: persistent_linked_list.c
+* Purpose: Contains function definitions for the persistent variant of my
+*          linked list implementation.
+*
+*          A doubly linked list changes the links of the neighbors of every
+*          node it adds or removes, so no node could be shared with a copy.
+*          The persistent list therefore keeps its elements in a tree, a treap
+*          ordered by position, in which every node counts the elements below
+*          it and holds a random priority no lower than its children's.  Any
+*          change to the tree only rewrites the nodes on the paths from the
+*          root to the positions changed, an expected logarithmic number.
+*
+*          Every node counts the links and snapshots referring to it.  Taking
+*          a snapshot only adds a reference to the root.  Before the list
+*          rewrites a node it checks that node's count: a node referred to
+*          from elsewhere is copied, the copy referring to the same children,
+*          and only the list's own nodes are changed in place.  Snapshots thus
+*          never see a change, and the list copies just the nodes it changes
+*          while a snapshot shares them.
+*
+*          The list is changed by one thread at a time, but snapshots may be
+*          read and released by other threads while it is being changed, so
+*          the counts are atomic.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Include the header for the persistent list.
+#include "persistent_linked_list.h"
+
+// Include required stdlib headers.
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Definition for a persistent list node.
+// Contains:
+// - Number of links and snapshots referring to the node.
+// - Pointers to the subtrees of the elements before and after the node.
+// - Number of elements in the subtree rooted at the node.
+// - Priority of the node, no lower than the priorities of its children.
+// - Integer value being stored.
+typedef struct PersistentNode
+{
+    _Atomic size_t references;
+    struct PersistentNode *left;
+    struct PersistentNode *right;
+    size_t size;
+    uint32_t priority;
+    int data;
+} PersistentNode;
+
+// Internal function that prints a diagnostic message and aborts the program if
+// a call to malloc returns a null pointer.
+static void internal_bad_alloc(void)
+{
+    fprintf(stderr, "Memory allocation failed!\n");
+    abort();
+}
+
+// Internal function that prints a diagnostic message and aborts the program if
+// the user attempts to access an index which is outside the bounds of the list.
+static void internal_out_of_bounds(size_t const size, size_t const index)
+{
+    fprintf(stderr, "Attempt to access index out of range!\n");
+    fprintf(stderr, "Index %zu of list with size %zu.\n", index, size);
+    abort();
+}
+
+// Internal function that returns the number of elements in a subtree.
+static size_t internal_size(PersistentNode const *node)
+{
+    return node ? node->size : 0;
+}
+
+// Internal function that recounts the elements below a node after its
+// children changed.
+static void internal_update(PersistentNode *node)
+{
+    node->size = internal_size(node->left) + internal_size(node->right) + 1;
+}
+
+// Internal function that returns the next priority from the list's xorshift
+// generator.
+static uint32_t internal_next_priority(PersistentIntegerList *list)
+{
+    list->random ^= list->random << 13;
+    list->random ^= list->random >> 7;
+    list->random ^= list->random << 17;
+    return (uint32_t)(list->random >> 32);
+}
+
+// Internal function that allocates a node without children, referred to
+// once.  Aborts the program if allocation fails.
+static PersistentNode *internal_create_node(PersistentIntegerList *list, int const value)
+{
+    PersistentNode *node = malloc(sizeof(PersistentNode));
+
+    if (!node) { internal_bad_alloc(); }
+
+    atomic_init(&node->references, 1);
+    node->left = NULL;
+    node->right = NULL;
+    node->size = 1;
+    node->priority = internal_next_priority(list);
+    node->data = value;
+    return node;
+}
+
+// Internal function that adds a reference to a node.
+static void internal_retain(PersistentNode const *node)
+{
+    if (node)
+    {
+        atomic_fetch_add_explicit(&((PersistentNode *)node)->references, 1,
+                                  memory_order_relaxed);
+    }
+}
+
+// Internal function that drops a reference to a node, freeing the node once
+// nothing refers to it, which in turn drops its references to its children.
+static void internal_release(PersistentNode const *node)
+{
+    while (node &&
+           atomic_fetch_sub_explicit(&((PersistentNode *)node)->references, 1,
+                                     memory_order_acq_rel) == 1)
+    {
+        // Release the left subtree recursively and the right one in the
+        // loop, so that a long chain of right children cannot exhaust the
+        // stack.
+        PersistentNode *freed = (PersistentNode *)node;
+        internal_release(freed->left);
+        node = freed->right;
+        free(freed);
+    }
+}
+
+// Internal function that returns a node the caller may change, given the
+// caller's reference to `node`.  A node referred to from elsewhere is copied,
+// with the copy referring to the same children, and the caller's reference
+// moves to the copy.
+static PersistentNode *internal_unique(PersistentNode *node)
+{
+    if (atomic_load_explicit(&node->references, memory_order_acquire) == 1) { return node; }
+
+    PersistentNode *copy = malloc(sizeof(PersistentNode));
+
+    if (!copy) { internal_bad_alloc(); }
+
+    atomic_init(&copy->references, 1);
+    copy->left = node->left;
+    copy->right = node->right;
+    copy->size = node->size;
+    copy->priority = node->priority;
+    copy->data = node->data;
+
+    internal_retain(copy->left);
+    internal_retain(copy->right);
+    internal_release(node);
+    return copy;
+}
+
+// Internal function that splits a subtree into its first `count` elements,
+// stored in `left`, and the rest, stored in `right`.  Takes over the caller's
+// reference to `node`, and hands the caller a reference to each part.
+static void internal_split(PersistentNode *node, size_t const count, PersistentNode **left,
+                           PersistentNode **right)
+{
+    if (!node)
+    {
+        *left = NULL;
+        *right = NULL;
+        return;
+    }
+
+    node = internal_unique(node);
+    size_t const leftSize = internal_size(node->left);
+
+    if (count <= leftSize)
+    {
+        internal_split(node->left, count, left, &node->left);
+        internal_update(node);
+        *right = node;
+    }
+    else
+    {
+        internal_split(node->right, count - leftSize - 1, &node->right, right);
+        internal_update(node);
+        *left = node;
+    }
+}
+
+// Internal function that joins two subtrees, every element of `left` coming
+// before every element of `right`.  Takes over the caller's references to
+// both, and returns a reference to the joined subtree.
+static PersistentNode *internal_merge(PersistentNode *left, PersistentNode *right)
+{
+    if (!left) { return right; }
+    if (!right) { return left; }
+
+    // The root with the higher priority stays on top.
+    if (left->priority > right->priority)
+    {
+        left = internal_unique(left);
+        left->right = internal_merge(left->right, right);
+        internal_update(left);
+        return left;
+    }
+
+    right = internal_unique(right);
+    right->left = internal_merge(left, right->left);
+    internal_update(right);
+    return right;
+}
+
+// Internal function that recounts the elements of a subtree built by
+// internal_build().
+static void internal_count(PersistentNode *node)
+{
+    if (!node) { return; }
+
+    internal_count(node->left);
+    internal_count(node->right);
+    internal_update(node);
+}
+
+// Internal function that builds a subtree holding `values` in order, in
+// linear time.  Each new node becomes the right child of the last node on the
+// right spine with a higher priority, adopting the nodes it climbs past as
+// its left subtree.  Returns a reference to the subtree.
+static PersistentNode *internal_build(PersistentIntegerList *list, int const *values,
+                                      size_t const count)
+{
+    if (count == 0) { return NULL; }
+
+    PersistentNode **spine = malloc(count * sizeof(PersistentNode *));
+    if (!spine) { internal_bad_alloc(); }
+
+    size_t depth = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        PersistentNode *node = internal_create_node(list, values[i]);
+        PersistentNode *adopted = NULL;
+
+        while (depth > 0 && spine[depth - 1]->priority < node->priority)
+        {
+            adopted = spine[--depth];
+        }
+
+        node->left = adopted;
+        if (depth > 0) { spine[depth - 1]->right = node; }
+        spine[depth++] = node;
+    }
+
+    PersistentNode *root = spine[0];
+    free(spine);
+
+    internal_count(root);
+    return root;
+}
+
+// Internal function that returns the node at `index` of a subtree, which must
+// be within its bounds.
+static PersistentNode const *internal_locate(PersistentNode const *node, size_t index)
+{
+    while (true)
+    {
+        size_t const leftSize = internal_size(node->left);
+
+        if (index == leftSize) { return node; }
+
+        if (index < leftSize)
+        {
+            node = node->left;
+        }
+        else
+        {
+            index -= leftSize + 1;
+            node = node->right;
+        }
+    }
+}
+
+// Internal function that copies the values of a subtree in order to
+// `values`, up to `capacity` values, starting after the `*count` values
+// already copied.
+static void internal_export(PersistentNode const *node, int *values, size_t const capacity,
+                            size_t *count)
+{
+    while (node && *count < capacity)
+    {
+        internal_export(node->left, values, capacity, count);
+        if (*count == capacity) { return; }
+
+        values[(*count)++] = node->data;
+        node = node->right;
+    }
+}
+
+// Internal function that searches a subtree in order for `value`, counting
+// the elements passed in `*index`.  Returns true once the value is found, with
+// `*index` holding its position.
+static bool internal_find(PersistentNode const *node, int const value, size_t *index)
+{
+    while (node)
+    {
+        if (internal_find(node->left, value, index)) { return true; }
+        if (node->data == value) { return true; }
+
+        ++*index;
+        node = node->right;
+    }
+
+    return false;
+}
+
+// Internal function that removes the element at `index`, which must be within
+// the bounds of the list.
+static void internal_remove(PersistentIntegerList *list, size_t const index)
+{
+    PersistentNode *before;
+    PersistentNode *rest;
+    PersistentNode *removed;
+    PersistentNode *after;
+
+    internal_split(list->root, index, &before, &rest);
+    internal_split(rest, 1, &removed, &after);
+    internal_release(removed);
+    list->root = internal_merge(before, after);
+}
+
+// Initializes an empty list.  Returns true, the list allocates nothing until
+// elements are added.
+bool persistent_list_initialize(PersistentIntegerList *list)
+{
+    list->root = NULL;
+    list->random = 0x9E3779B97F4A7C15ULL;
+    return true;
+}
+
+// Releases the list's references to its nodes, freeing every node no snapshot
+// still refers to.  The list must be initialized again before reuse.
+void persistent_list_cleanup(PersistentIntegerList *list)
+{
+    internal_release(list->root);
+    list->root = NULL;
+}
+
+// Removes every element from the list.  Snapshots keep their elements.
+void persistent_list_clear(PersistentIntegerList *list)
+{
+    internal_release(list->root);
+    list->root = NULL;
+}
+
+// Adds a node with the specified value to the back of the list.
+void persistent_list_push_back(PersistentIntegerList *list, int const value)
+{
+    list->root = internal_merge(list->root, internal_create_node(list, value));
+}
+
+// Adds a node with the specified value to the front of the list.
+void persistent_list_push_front(PersistentIntegerList *list, int const value)
+{
+    list->root = internal_merge(internal_create_node(list, value), list->root);
+}
+
+// Adds `count` values to the back of the list, in order.  The values are
+// built into a tree of their own in linear time, which is then joined to the
+// list.
+void persistent_list_push_back_array(PersistentIntegerList *list, int const *values,
+                                     size_t const count)
+{
+    list->root = internal_merge(list->root, internal_build(list, values, count));
+}
+
+// Removes the last node in the list.
+void persistent_list_pop_back(PersistentIntegerList *list)
+{
+    if (!list->root) { return; }
+
+    internal_remove(list, list->root->size - 1);
+}
+
+// Removes the first node in the list.
+void persistent_list_pop_front(PersistentIntegerList *list)
+{
+    if (!list->root) { return; }
+
+    internal_remove(list, 0);
+}
+
+// Removes a node at the specified index.
+void persistent_list_remove_at_index(PersistentIntegerList *list, size_t const index)
+{
+    // If the index passed as an argument is greater than the number of
+    // elements in the list, print a diagnostic message and abort.
+    size_t const size = internal_size(list->root);
+    if (index >= size) { internal_out_of_bounds(size, index); }
+
+    internal_remove(list, index);
+}
+
+// Removes all nodes from the list that contain the specified value.  If the
+// value is present the remaining values are rebuilt into a new tree, in
+// linear time, rather than removing the matches one path at a time.
+void persistent_list_remove_value(PersistentIntegerList *list, int const value)
+{
+    size_t const size = internal_size(list->root);
+    if (persistent_list_find_first_index_containing(list, value) == size) { return; }
+
+    int *values = malloc(size * sizeof(int));
+    if (!values) { internal_bad_alloc(); }
+
+    size_t count = 0;
+    internal_export(list->root, values, size, &count);
+
+    // Keep every value which does not match, in order.
+    size_t kept = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (values[i] != value) { values[kept++] = values[i]; }
+    }
+
+    internal_release(list->root);
+    list->root = internal_build(list, values, kept);
+    free(values);
+}
+
+// Returns the number of elements in the list.
+size_t persistent_list_size(PersistentIntegerList const *list)
+{
+    return internal_size(list->root);
+}
+
+// Returns the value stored at the end of the list, aborting if it is empty.
+int persistent_list_back(PersistentIntegerList const *list)
+{
+    if (!list->root) { internal_out_of_bounds(0, 0); }
+
+    return internal_locate(list->root, list->root->size - 1)->data;
+}
+
+// Returns the value stored at the beginning of the list, aborting if it is
+// empty.
+int persistent_list_front(PersistentIntegerList const *list)
+{
+    if (!list->root) { internal_out_of_bounds(0, 0); }
+
+    return internal_locate(list->root, 0)->data;
+}
+
+// Returns the value stored at the specified index, found from the root in an
+// expected logarithmic number of steps.
+int persistent_list_element_at(PersistentIntegerList const *list, size_t const index)
+{
+    // If the index passed as an argument is greater than the number of
+    // elements in the list, print a diagnostic message and abort.
+    size_t const size = internal_size(list->root);
+    if (index >= size) { internal_out_of_bounds(size, index); }
+
+    return internal_locate(list->root, index)->data;
+}
+
+// Returns the index of the first node that contains the desired value if the
+// value exists in the list, otherwise the size of the list is returned.
+size_t persistent_list_find_first_index_containing(PersistentIntegerList const *list,
+                                                   int const value)
+{
+    size_t index = 0;
+
+    internal_find(list->root, value, &index);
+    return index;
+}
+
+// Returns a read-only snapshot of the list as it is now, in constant time.
+// The snapshot shares every node with the list, and the list copies a shared
+// node before changing it, so the snapshot never changes.  The snapshot may
+// be read and released by other threads while the list is being changed, and
+// must be released with persistent_snapshot_release().
+PersistentListSnapshot persistent_list_snapshot(PersistentIntegerList const *list)
+{
+    PersistentListSnapshot snapshot = { list->root };
+
+    internal_retain(list->root);
+    return snapshot;
+}
+
+// Releases a snapshot, freeing the nodes nothing else refers to.
+void persistent_snapshot_release(PersistentListSnapshot *snapshot)
+{
+    internal_release(snapshot->root);
+    snapshot->root = NULL;
+}
+
+// Returns the number of elements in the snapshot.
+size_t persistent_snapshot_size(PersistentListSnapshot const *snapshot)
+{
+    return internal_size(snapshot->root);
+}
+
+// Returns the value stored at the specified index of the snapshot.
+int persistent_snapshot_element_at(PersistentListSnapshot const *snapshot, size_t const index)
+{
+    // If the index passed as an argument is greater than the number of
+    // elements in the snapshot, print a diagnostic message and abort.
+    size_t const size = internal_size(snapshot->root);
+    if (index >= size) { internal_out_of_bounds(size, index); }
+
+    return internal_locate(snapshot->root, index)->data;
+}
+
+// Copies the values of the snapshot in order to `values`, up to `capacity`
+// values.  Returns the number of values copied.
+size_t persistent_snapshot_export_array(PersistentListSnapshot const *snapshot, int *values,
+                                        size_t const capacity)
+{
+    size_t count = 0;
+
+    internal_export(snapshot->root, values, capacity, &count);
+    return count;
+}
+
+// Returns the index of the first node of the snapshot that contains the
+// desired value if the value exists in it, otherwise the size of the snapshot
+// is returned.
+size_t persistent_snapshot_find_first_index_containing(PersistentListSnapshot const *snapshot,
+                                                       int const value)
+{
+    size_t index = 0;
+
+    internal_find(snapshot->root, value, &index);
+    return index;
+}
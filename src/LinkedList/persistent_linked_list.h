@@ -0,0 +1,84 @@
+/*
+* File Name: persistent_linked_list.h
+* Purpose: Contains the public types and function declarations for the
+*          persistent variant of my linked list implementation, whose
+*          snapshots are taken in constant time and share their nodes with the
+*          list until the list changes them.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_PERSISTENT_LINKED_LIST_H
+#define BACHURSKI_PERSISTENT_LINKED_LIST_H
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Persistent Linked List Handle
+// Contains:
+// - Pointer to the root of the tree holding the elements in list order.
+// - State of the generator for the priorities that balance the tree.
+typedef struct PersistentIntegerList
+{
+    struct PersistentNode *root;
+    uint64_t random;
+} PersistentIntegerList;
+
+// Read-only view of a persistent list as it was when the snapshot was taken.
+// Contains:
+// - Pointer to the root of the tree at that time, shared with the list.
+typedef struct PersistentListSnapshot
+{
+    struct PersistentNode const *root;
+} PersistentListSnapshot;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying persistent_linked_list.c
+    * file.  Comments only serve to separate declarations by their general
+    * purpose.
+*/
+
+// Initialization
+bool persistent_list_initialize(PersistentIntegerList *list);
+
+// Cleanup
+void persistent_list_cleanup(PersistentIntegerList *list);
+
+// Modifiers
+void persistent_list_clear(PersistentIntegerList *list);
+void persistent_list_push_back(PersistentIntegerList *list, int const value);
+void persistent_list_push_front(PersistentIntegerList *list, int const value);
+void persistent_list_push_back_array(PersistentIntegerList *list, int const *values,
+                                     size_t const count);
+void persistent_list_pop_back(PersistentIntegerList *list);
+void persistent_list_pop_front(PersistentIntegerList *list);
+void persistent_list_remove_at_index(PersistentIntegerList *list, size_t const index);
+void persistent_list_remove_value(PersistentIntegerList *list, int const value);
+
+// Element Access
+size_t persistent_list_size(PersistentIntegerList const *list);
+int persistent_list_back(PersistentIntegerList const *list);
+int persistent_list_front(PersistentIntegerList const *list);
+int persistent_list_element_at(PersistentIntegerList const *list, size_t const index);
+
+// Search
+size_t persistent_list_find_first_index_containing(PersistentIntegerList const *list,
+                                                   int const value);
+
+// Snapshots
+PersistentListSnapshot persistent_list_snapshot(PersistentIntegerList const *list);
+void persistent_snapshot_release(PersistentListSnapshot *snapshot);
+size_t persistent_snapshot_size(PersistentListSnapshot const *snapshot);
+int persistent_snapshot_element_at(PersistentListSnapshot const *snapshot, size_t const index);
+size_t persistent_snapshot_export_array(PersistentListSnapshot const *snapshot, int *values,
+                                        size_t const capacity);
+size_t persistent_snapshot_find_first_index_containing(PersistentListSnapshot const *snapshot,
+                                                       int const value);
+
+// End of header guard.
+#endif
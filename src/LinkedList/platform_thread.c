@@ -0,0 +1,129 @@
+/*
+* File Name: platform_thread.c
+* Purpose: Contains function definitions which wrap the threads and mutexes
+*          of each platform for my linked list implementation.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Include the header for the platform threads.
+#include "platform_thread.h"
+
+// Include the platform headers which provide yielding and processor counts.
+// Conditional compilation for Unix environment.
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <sched.h>
+#include <unistd.h>
+// End conditional compilation.
+#endif
+
+// Internal function that runs the thread's function, adapting it to the
+// signature each platform expects of a thread entry point.
+#if defined(_WIN32) || defined(_WIN64)
+static DWORD WINAPI internal_thread_entry(LPVOID parameter)
+{
+    PlatformThread *thread = (PlatformThread *)parameter;
+    thread->function(thread->argument);
+    return 0;
+}
+#else
+static void *internal_thread_entry(void *parameter)
+{
+    PlatformThread *thread = (PlatformThread *)parameter;
+    thread->function(thread->argument);
+    return NULL;
+}
+#endif
+
+// Starts a thread running `function(argument)`.  The thread structure must
+// stay in place until the thread is joined.  Returns false if the thread
+// cannot be started.
+bool platform_thread_start(PlatformThread *thread, PlatformThreadFunction function,
+                           void *argument)
+{
+    thread->function = function;
+    thread->argument = argument;
+
+#if defined(_WIN32) || defined(_WIN64)
+    thread->handle = CreateThread(NULL, 0, internal_thread_entry, thread, 0, NULL);
+    return thread->handle != NULL;
+#else
+    return pthread_create(&thread->handle, NULL, internal_thread_entry, thread) == 0;
+#endif
+}
+
+// Waits for a started thread to finish.
+void platform_thread_join(PlatformThread *thread)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+#else
+    pthread_join(thread->handle, NULL);
+#endif
+}
+
+// Lets other threads run before the calling thread continues.
+void platform_thread_yield(void)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+// Returns the number of processors available to the program, at least one.
+size_t platform_processor_count(void)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    SYSTEM_INFO information;
+    GetSystemInfo(&information);
+    return information.dwNumberOfProcessors > 0 ? (size_t)information.dwNumberOfProcessors : 1;
+#else
+    long const count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (size_t)count : 1;
+#endif
+}
+
+// Initializes a mutex.  Returns false if that fails.
+bool platform_mutex_initialize(PlatformMutex *mutex)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    InitializeSRWLock(&mutex->lock);
+    return true;
+#else
+    return pthread_mutex_init(&mutex->lock, NULL) == 0;
+#endif
+}
+
+// Releases the resources of a mutex, which must not be locked.
+void platform_mutex_cleanup(PlatformMutex *mutex)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    (void)mutex;
+#else
+    pthread_mutex_destroy(&mutex->lock);
+#endif
+}
+
+// Locks a mutex, waiting until no other thread holds it.
+void platform_mutex_lock(PlatformMutex *mutex)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    AcquireSRWLockExclusive(&mutex->lock);
+#else
+    pthread_mutex_lock(&mutex->lock);
+#endif
+}
+
+// Unlocks a mutex held by the calling thread.
+void platform_mutex_unlock(PlatformMutex *mutex)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    ReleaseSRWLockExclusive(&mutex->lock);
+#else
+    pthread_mutex_unlock(&mutex->lock);
+#endif
+}
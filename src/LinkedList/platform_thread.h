@@ -0,0 +1,79 @@
+/*
+* File Name: platform_thread.h
+* Purpose: Contains the private types and function declarations which wrap
+*          the threads and mutexes of each platform for my linked list
+*          implementation.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_PLATFORM_THREAD_H
+#define BACHURSKI_PLATFORM_THREAD_H
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+
+// Include the platform headers which provide threads and mutexes.
+// Conditional compilation for Windows environment.
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+// Conditional compilation for Unix environment.
+#else
+#include <pthread.h>
+// End conditional compilation.
+#endif
+
+// Function run by a thread, receiving the argument passed when the thread was
+// started.
+typedef void (*PlatformThreadFunction)(void *argument);
+
+// Definition for a thread.
+// Contains:
+// - Handle of the thread on this platform.
+// - Function the thread runs, and its argument.
+typedef struct PlatformThread
+{
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+    PlatformThreadFunction function;
+    void *argument;
+} PlatformThread;
+
+// Definition for a mutex.
+// Contains:
+// - Lock of this platform.
+typedef struct PlatformMutex
+{
+#if defined(_WIN32) || defined(_WIN64)
+    SRWLOCK lock;
+#else
+    pthread_mutex_t lock;
+#endif
+} PlatformMutex;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying platform_thread.c file.
+*/
+
+// Threads
+bool platform_thread_start(PlatformThread *thread, PlatformThreadFunction function,
+                           void *argument);
+void platform_thread_join(PlatformThread *thread);
+void platform_thread_yield(void);
+size_t platform_processor_count(void);
+
+// Mutexes
+bool platform_mutex_initialize(PlatformMutex *mutex);
+void platform_mutex_cleanup(PlatformMutex *mutex);
+void platform_mutex_lock(PlatformMutex *mutex);
+void platform_mutex_unlock(PlatformMutex *mutex);
+
+// End of header guard.
+#endif
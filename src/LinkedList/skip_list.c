@@ -0,0 +1,423 @@
+/*
+* File Name: skip_list.c
+* Purpose: Contains constants, types, and function definitions for my
+*          indexable skip list implementation.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Include the header for the skip list.
+#include "skip_list.h"
+
+// Include the private formatter shared with the other list implementations.
+#include "output_buffer.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Defines a constant for the highest level a node can reach, enough for far
+// more elements than fit in memory with the promotion odds below.
+#define SKIP_LIST_MAX_LEVEL 32
+
+// Defines a constant mask applied to random bits when promoting a node, a
+// node reaches each further level with a chance of one in four.
+#define SKIP_LIST_PROMOTION_MASK 3u
+
+// Defines a constant used to seed the level generator of every list, levels
+// only need to be well distributed, not unpredictable.
+#define SKIP_LIST_SEED 0x9E3779B97F4A7C15ULL
+
+// Internal function that prints a diagnostic message and aborts the program in
+// the unlikely event that memory allocation fails.
+static void internal_bad_alloc(void)
+{
+    fprintf(stderr, "Memory allocation failed!\n");
+    abort();
+}
+
+// Internal function that prints a diagnostic message and aborts the program if
+// the user attempts to access an index which is outside the bounds of the list.
+static void internal_out_of_bounds(size_t const size, size_t const index)
+{
+    fprintf(stderr, "Attempt to access index out of range!\n");
+    fprintf(stderr, "Index %zu of list with size %zu.\n", index, size);
+    abort();
+}
+
+// Definition for a forward link of a skip list node.
+// Contains:
+// - Pointer to the `next` node on this level.
+// - Number of positions the link skips, so that following it from a node at
+//   position p arrives at position p + span.
+typedef struct IntegerSkipLink
+{
+    struct IntegerSkipNode *next;
+    size_t span;
+} IntegerSkipLink;
+
+// Definition for a skip list node.
+// Contains:
+// - Pointer to the `previous` node on the lowest level.
+// - Integer value being stored.
+// - Number of levels the node takes part in.
+// - One forward link per level, stored inline after the node.
+typedef struct IntegerSkipNode
+{
+    struct IntegerSkipNode *previous;
+    int data;
+    int level;
+    IntegerSkipLink links[];
+} IntegerSkipNode;
+
+// Internal function that allocates a node taking part in `level` levels,
+// aborting the program if allocation fails.
+static IntegerSkipNode *internal_allocate_node(int const level)
+{
+    IntegerSkipNode *node = (IntegerSkipNode *)malloc(
+        sizeof(IntegerSkipNode) + (size_t)level * sizeof(IntegerSkipLink));
+
+    // If allocation fails, print a diagnostic message and abort the program.
+    if (!node) { internal_bad_alloc(); }
+
+    node->previous = NULL;
+    node->level = level;
+
+    return node;
+}
+
+// Internal function that picks the level of a new node.  Every node is on the
+// first level, and each further level is reached with a chance of one in four.
+static int internal_random_level(IntegerSkipList *list)
+{
+    // Advance the xorshift generator and scramble its output.
+    unsigned long long state = list->randomState;
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    list->randomState = state;
+    unsigned long long bits = state * 0x2545F4914F6CDD1DULL;
+
+    // Promote the node while pairs of random bits come up zero.
+    int level = 1;
+    while ((bits & SKIP_LIST_PROMOTION_MASK) == 0 && level < SKIP_LIST_MAX_LEVEL)
+    {
+        ++level;
+        bits >>= 2;
+    }
+
+    return level;
+}
+
+// Internal function that finds, on every level, the last node positioned
+// before position `rank`, where the header is position zero and the element
+// at index i is position i + 1.  The nodes are stored in `update` and their
+// positions in `updateRank`.
+static void internal_find_predecessors(IntegerSkipList const *list, size_t const rank,
+                                       IntegerSkipNode **update, size_t *updateRank)
+{
+    IntegerSkipNode *node = list->header;
+    size_t traversed = 0;
+
+    // Starting from the highest level, move forward while the next node is
+    // still before the target position, then drop down a level.
+    for (int i = list->level - 1; i >= 0; --i)
+    {
+        while (node->links[i].next && traversed + node->links[i].span < rank)
+        {
+            traversed += node->links[i].span;
+            node = node->links[i].next;
+        }
+
+        update[i] = node;
+        updateRank[i] = traversed;
+    }
+}
+
+// Internal function that returns the node at the specified index.
+static IntegerSkipNode *internal_node_at(IntegerSkipList const *list, size_t const index)
+{
+    size_t const rank = index + 1;
+    IntegerSkipNode *node = list->header;
+    size_t traversed = 0;
+
+    // Follow the longest links that do not overshoot the target position.
+    for (int i = list->level - 1; i >= 0; --i)
+    {
+        while (node->links[i].next && traversed + node->links[i].span <= rank)
+        {
+            traversed += node->links[i].span;
+            node = node->links[i].next;
+        }
+
+        // The target has been reached, no lower level is needed.
+        if (traversed == rank) { break; }
+    }
+
+    return node;
+}
+
+
+// Initialize the skip list handle.
+bool skip_list_initialize(IntegerSkipList *list)
+{
+    // Allocate a header that links to the first node on every level.
+    list->header = (IntegerSkipNode *)malloc(
+        sizeof(IntegerSkipNode) + SKIP_LIST_MAX_LEVEL * sizeof(IntegerSkipLink));
+
+    // If the header cannot be allocated initialization has failed.
+    if (!list->header) { return false; }
+
+    list->header->previous = NULL;
+    list->header->data = 0;
+    list->header->level = SKIP_LIST_MAX_LEVEL;
+
+    // Every level starts out empty.
+    for (int i = 0; i < SKIP_LIST_MAX_LEVEL; ++i)
+    {
+        list->header->links[i].next = NULL;
+        list->header->links[i].span = 0;
+    }
+
+    list->tail = NULL;
+    list->size = 0;
+    list->level = 1;
+    list->randomState = SKIP_LIST_SEED;
+
+    // Initialization success, return true.
+    return true;
+}
+
+// Cleanup function that frees all allocated memory resources, including the
+// header.  The list must be initialized again before reuse.
+void skip_list_cleanup(IntegerSkipList *list)
+{
+    skip_list_clear(list);
+    free(list->header);
+    list->header = NULL;
+}
+
+// Clears the list by freeing every node, walking the lowest level which
+// links every node.
+void skip_list_clear(IntegerSkipList *list)
+{
+    IntegerSkipNode *node = list->header->links[0].next;
+    while (node)
+    {
+        IntegerSkipNode *next = node->links[0].next;
+        free(node);
+        node = next;
+    }
+
+    // Reset the header links and the handle to the empty state.
+    for (int i = 0; i < SKIP_LIST_MAX_LEVEL; ++i)
+    {
+        list->header->links[i].next = NULL;
+        list->header->links[i].span = 0;
+    }
+
+    list->tail = NULL;
+    list->size = 0;
+    list->level = 1;
+}
+
+// Appends a value to the end of the list.
+void skip_list_push_back(IntegerSkipList *list, int const value)
+{
+    skip_list_insert_at_index(list, list->size, value);
+}
+
+// Prepends a value to the front of the list.
+void skip_list_push_front(IntegerSkipList *list, int const value)
+{
+    skip_list_insert_at_index(list, 0, value);
+}
+
+// Removes the last value in the list.
+void skip_list_pop_back(IntegerSkipList *list)
+{
+    // If the list is empty there is nothing to remove.
+    if (list->size == 0) { return; }
+
+    skip_list_remove_at_index(list, list->size - 1);
+}
+
+// Removes the first value in the list.
+void skip_list_pop_front(IntegerSkipList *list)
+{
+    // If the list is empty there is nothing to remove.
+    if (list->size == 0) { return; }
+
+    skip_list_remove_at_index(list, 0);
+}
+
+// Inserts a value so that it ends up at the specified index, shifting the
+// value previously at that index and every later value back by one.  An index
+// equal to the size of the list appends the value.
+void skip_list_insert_at_index(IntegerSkipList *list, size_t const index, int const value)
+{
+    // Inserting past the end of the list is an error, print a diagnostic
+    // message and abort.
+    if (index > list->size) { internal_out_of_bounds(list->size, index); }
+
+    // Find the nodes that will precede the new node on every level.  The new
+    // node takes position index + 1, so its predecessors are at most at
+    // position index.
+    IntegerSkipNode *update[SKIP_LIST_MAX_LEVEL] = { NULL };
+    size_t updateRank[SKIP_LIST_MAX_LEVEL];
+    internal_find_predecessors(list, index + 1, update, updateRank);
+
+    // Pick the level of the new node, levels not in use yet start at the
+    // header and span the whole list.
+    int const level = internal_random_level(list);
+    if (level > list->level)
+    {
+        for (int i = list->level; i < level; ++i)
+        {
+            update[i] = list->header;
+            updateRank[i] = 0;
+            list->header->links[i].span = list->size;
+        }
+        list->level = level;
+    }
+
+    // Splice the node in on each of its levels, splitting the span of the
+    // link it is inserted into.
+    IntegerSkipNode *node = internal_allocate_node(level);
+    node->data = value;
+
+    for (int i = 0; i < level; ++i)
+    {
+        size_t const distance = index - updateRank[i];
+        node->links[i].next = update[i]->links[i].next;
+        node->links[i].span = update[i]->links[i].span - distance;
+        update[i]->links[i].next = node;
+        update[i]->links[i].span = distance + 1;
+    }
+
+    // Links above the node now jump over one more position.
+    for (int i = level; i < list->level; ++i) { ++update[i]->links[i].span; }
+
+    // Maintain the backward link on the lowest level, and the tail.
+    node->previous = (update[0] == list->header) ? NULL : update[0];
+    if (node->links[0].next)
+    {
+        node->links[0].next->previous = node;
+    }
+    else
+    {
+        list->tail = node;
+    }
+
+    ++list->size;
+}
+
+// Removes the value at the specified index.
+void skip_list_remove_at_index(IntegerSkipList *list, size_t const index)
+{
+    // If the index passed as an argument is greater than the number of
+    // elements in the list, print a diagnostic message and abort.
+    if (index >= list->size) { internal_out_of_bounds(list->size, index); }
+
+    // Find the nodes preceding the removed node on every level.
+    IntegerSkipNode *update[SKIP_LIST_MAX_LEVEL] = { NULL };
+    size_t updateRank[SKIP_LIST_MAX_LEVEL];
+    internal_find_predecessors(list, index + 1, update, updateRank);
+
+    IntegerSkipNode *node = update[0]->links[0].next;
+
+    // Unlink the node on its levels, merging its spans into the predecessor,
+    // and shorten the links which jump over it on higher levels.
+    for (int i = 0; i < list->level; ++i)
+    {
+        if (update[i]->links[i].next == node)
+        {
+            update[i]->links[i].span += node->links[i].span - 1;
+            update[i]->links[i].next = node->links[i].next;
+        }
+        else
+        {
+            --update[i]->links[i].span;
+        }
+    }
+
+    // Maintain the backward link on the lowest level, and the tail.
+    if (node->links[0].next)
+    {
+        node->links[0].next->previous = node->previous;
+    }
+    else
+    {
+        list->tail = node->previous;
+    }
+
+    // Drop levels which no longer hold any node.
+    while (list->level > 1 && !list->header->links[list->level - 1].next)
+    {
+        list->header->links[list->level - 1].span = 0;
+        --list->level;
+    }
+
+    free(node);
+    --list->size;
+}
+
+// Returns the value stored at the end of the list.
+int skip_list_back(IntegerSkipList const *list)
+{
+    return list->tail->data;
+}
+
+// Returns the value stored at the beginning of the list.
+int skip_list_front(IntegerSkipList const *list)
+{
+    return list->header->links[0].next->data;
+}
+
+// Returns the value stored at the specified index.
+int skip_list_element_at(IntegerSkipList const *list, size_t const index)
+{
+    // If the index passed as an argument is greater than the number of
+    // elements in the list, print a diagnostic message and abort.
+    if (index >= list->size) { internal_out_of_bounds(list->size, index); }
+
+    return internal_node_at(list, index)->data;
+}
+
+// Returns the index of the first node that contains the desired value if the
+// value exists in the list, otherwise the size of the list is returned.
+size_t skip_list_find_first_index_containing(IntegerSkipList const *list, int const value)
+{
+    size_t index = 0;
+
+    // Values are not ordered, so scan the lowest level front to back.
+    for (IntegerSkipNode const *node = list->header->links[0].next; node;
+         node = node->links[0].next)
+    {
+        if (node->data == value) { return index; }
+        ++index;
+    }
+
+    return index;
+}
+
+// Print the size of the list as well as each element in the list to stdout,
+// using the same format as linked_list_print_list().
+void skip_list_print_list(IntegerSkipList const *list)
+{
+    // Prepare the buffer, aborting the program if allocation fails.
+    OutputBuffer buffer;
+    if (!output_buffer_open(&buffer, stdout)) { internal_bad_alloc(); }
+
+    output_buffer_begin_list(&buffer, list->size);
+    for (IntegerSkipNode const *node = list->header->links[0].next; node;
+         node = node->links[0].next)
+    {
+        output_buffer_append_element(&buffer, node->data);
+    }
+    output_buffer_end_list(&buffer);
+
+    output_buffer_close(&buffer);
+}
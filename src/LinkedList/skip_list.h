@@ -0,0 +1,69 @@
+/*
+* File Name: skip_list.h
+* Purpose: Contains the public types and function declarations for my
+*          indexable skip list implementation, a list offering positional
+*          access in logarithmic time.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_SKIP_LIST_H
+#define BACHURSKI_SKIP_LIST_H
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stdio.h>
+
+// Skip List Handle
+// Contains:
+// - Pointer to the header node, which stores no value and links to the first
+//   node on every level.
+// - Pointer to the last node in the list.
+// - Number of elements in the list.
+// - Number of levels currently in use.
+// - State of the generator used to pick the level of new nodes.
+typedef struct IntegerSkipList
+{
+    struct IntegerSkipNode *header;
+    struct IntegerSkipNode *tail;
+    size_t size;
+    int level;
+    unsigned long long randomState;
+} IntegerSkipList;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying skip_list.c file.
+    * Comments only serve to separate declarations by their general purpose.
+*/
+
+// Initialization
+bool skip_list_initialize(IntegerSkipList *list);
+
+// Cleanup
+void skip_list_cleanup(IntegerSkipList *list);
+
+// Modifiers
+void skip_list_clear(IntegerSkipList *list);
+void skip_list_push_back(IntegerSkipList *list, int const value);
+void skip_list_push_front(IntegerSkipList *list, int const value);
+void skip_list_pop_back(IntegerSkipList *list);
+void skip_list_pop_front(IntegerSkipList *list);
+void skip_list_insert_at_index(IntegerSkipList *list, size_t const index, int const value);
+void skip_list_remove_at_index(IntegerSkipList *list, size_t const index);
+
+// Element Access
+int skip_list_back(IntegerSkipList const *list);
+int skip_list_front(IntegerSkipList const *list);
+int skip_list_element_at(IntegerSkipList const *list, size_t const index);
+
+// Search
+size_t skip_list_find_first_index_containing(IntegerSkipList const *list, int const value);
+
+// Display
+void skip_list_print_list(IntegerSkipList const *list);
+
+// End of header guard.
+#endif
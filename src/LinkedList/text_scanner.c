@@ -0,0 +1,155 @@
+/*
+* File Name: text_scanner.c
+* Purpose: Contains the function definitions for the integer scanner used by
+*          my linked list implementation to parse text files.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Include the header for the text scanner.
+#include "text_scanner.h"
+
+// Include required stdlib headers.
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+
+// Internal function that checks for the same whitespace characters that
+// fscanf() skips before a number in the "C" locale.
+static bool internal_is_space(char const character)
+{
+    return character == ' ' || character == '\n' || character == '\t' ||
+           character == '\r' || character == '\v' || character == '\f';
+}
+
+// Internal function that checks for a decimal digit.
+static bool internal_is_digit(char const character)
+{
+    return (unsigned)(character - '0') < 10u;
+}
+
+// Internal function that records the position of text which failed to parse.
+static TextScanStatus internal_fail(TextScanner *scanner, char const *token)
+{
+    scanner->errorOffset = (size_t)(token - scanner->begin);
+    scanner->errorLine = scanner->line;
+    scanner->errorColumn = (size_t)(token - scanner->lineStart) + 1;
+    return TEXT_SCAN_ERROR;
+}
+
+// Prepares a scanner to read integers from `length` characters of `text`.
+void text_scanner_initialize(TextScanner *scanner, char const *text, size_t const length)
+{
+    scanner->begin = text;
+    scanner->cursor = text;
+    scanner->end = text + length;
+    scanner->line = 1;
+    scanner->lineStart = text;
+    scanner->errorOffset = 0;
+    scanner->errorLine = 0;
+    scanner->errorColumn = 0;
+}
+
+// Internal function that reads the next integer from the text as a sign and
+// a magnitude, which may be at most `limit`.  The most negative integer of a
+// type is one larger in magnitude than the most positive, so negative
+// integers may be one larger.  Returns like text_scanner_next().
+static TextScanStatus internal_next_magnitude(TextScanner *scanner, unsigned long long const limit,
+                                              bool *negative, unsigned long long *magnitude)
+{
+    char const *cursor = scanner->cursor;
+    char const *end = scanner->end;
+
+    // Skip whitespace, keeping track of line boundaries for error reporting.
+    while (cursor < end && internal_is_space(*cursor))
+    {
+        if (*cursor == '\n')
+        {
+            ++scanner->line;
+            scanner->lineStart = cursor + 1;
+        }
+        ++cursor;
+    }
+
+    // Only whitespace was left, the text is exhausted.
+    scanner->cursor = cursor;
+    if (cursor == end) { return TEXT_SCAN_END; }
+
+    // Remember where the token starts so errors point at it.
+    char const *token = cursor;
+
+    // Consume an optional sign.
+    *negative = false;
+    if (*cursor == '-' || *cursor == '+')
+    {
+        *negative = (*cursor == '-');
+        ++cursor;
+    }
+
+    // A token must contain at least one digit.
+    if (cursor == end || !internal_is_digit(*cursor)) { return internal_fail(scanner, token); }
+
+    // Accumulate the magnitude, failing as soon as it can no longer fit.  The
+    // check comes before each step, so the magnitude itself never overflows.
+    unsigned long long const largest = *negative ? limit + 1u : limit;
+    unsigned long long const tenth = largest / 10u;
+    unsigned const lastDigit = (unsigned)(largest % 10u);
+    unsigned long long accumulated = 0;
+    while (cursor < end && internal_is_digit(*cursor))
+    {
+        unsigned const digit = (unsigned)(*cursor - '0');
+        if (accumulated > tenth || (accumulated == tenth && digit > lastDigit))
+        {
+            return internal_fail(scanner, token);
+        }
+        accumulated = accumulated * 10u + digit;
+        ++cursor;
+    }
+
+    // The token must end at whitespace or at the end of the text.
+    if (cursor < end && !internal_is_space(*cursor)) { return internal_fail(scanner, token); }
+
+    *magnitude = accumulated;
+    scanner->cursor = cursor;
+    return TEXT_SCAN_VALUE;
+}
+
+// Reads the next integer from the text.  Integers are an optional sign
+// followed by decimal digits and must be separated by whitespace, exactly as
+// in test_input.txt.  Returns TEXT_SCAN_END once only whitespace remains, and
+// TEXT_SCAN_ERROR if the next token is not an integer or does not fit in an
+// int, in which case the error position is recorded in the scanner.
+TextScanStatus text_scanner_next(TextScanner *scanner, int *value)
+{
+    bool negative = false;
+    unsigned long long magnitude = 0;
+    TextScanStatus const status = internal_next_magnitude(scanner, INT_MAX, &negative, &magnitude);
+
+    // Convert the magnitude back to a signed value, subtracting one before
+    // negating so that the most negative integer does not overflow.
+    if (status == TEXT_SCAN_VALUE)
+    {
+        *value = negative ? -(int)(magnitude - 1u) - 1 : (int)magnitude;
+    }
+
+    return status;
+}
+
+// Reads the next integer from the text like text_scanner_next(), allowing
+// any value that fits in a long long.
+TextScanStatus text_scanner_next_long_long(TextScanner *scanner, long long *value)
+{
+    bool negative = false;
+    unsigned long long magnitude = 0;
+    TextScanStatus const status = internal_next_magnitude(scanner, LLONG_MAX, &negative,
+                                                          &magnitude);
+
+    if (status == TEXT_SCAN_VALUE)
+    {
+        *value = negative ? -(long long)(magnitude - 1u) - 1 : (long long)magnitude;
+    }
+
+    return status;
+}
@@ -0,0 +1,56 @@
+/*
+* File Name: text_scanner.h
+* Purpose: Contains the private type and function declarations for the
+*          integer scanner used by my linked list implementation to parse
+*          text files.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_TEXT_SCANNER_H
+#define BACHURSKI_TEXT_SCANNER_H
+
+// Include required stdlib headers.
+#include <stddef.h>
+
+// Result of asking the scanner for the next integer.
+typedef enum TextScanStatus
+{
+    TEXT_SCAN_VALUE,
+    TEXT_SCAN_END,
+    TEXT_SCAN_ERROR
+} TextScanStatus;
+
+// Scanner over a block of text holding whitespace separated integers.
+// Contains:
+// - Pointer to the first character of the text.
+// - Pointer to the next character to be scanned.
+// - Pointer one past the last character of the text.
+// - Line number of the next character, starting at one.
+// - Pointer to the first character of that line.
+// - Byte offset, line and column of the text that failed to parse.
+typedef struct TextScanner
+{
+    char const *begin;
+    char const *cursor;
+    char const *end;
+    size_t line;
+    char const *lineStart;
+    size_t errorOffset;
+    size_t errorLine;
+    size_t errorColumn;
+} TextScanner;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying text_scanner.c file.
+*/
+
+void text_scanner_initialize(TextScanner *scanner, char const *text, size_t const length);
+TextScanStatus text_scanner_next(TextScanner *scanner, int *value);
+TextScanStatus text_scanner_next_long_long(TextScanner *scanner, long long *value);
+
+// End of header guard.
+#endif
@@ -0,0 +1,519 @@
+/*
+* File Name: unrolled_linked_list.c
+* Purpose: Contains constants, types, and function definitions for my
+*          unrolled linked list implementation.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Include the header for the unrolled linked list.
+#include "unrolled_linked_list.h"
+
+// Include the private formatter shared with the other list implementations.
+#include "output_buffer.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Defines a constant for the number of integers a single node can hold.  With
+// two pointers and a count this makes every node exactly 128 bytes, two cache
+// lines on common hardware.
+#define UNROLLED_NODE_CAPACITY 27
+
+// Defines a constant for the element count below which a node attempts to
+// merge with its neighbor, keeping nodes at least half full after removals.
+#define UNROLLED_MERGE_THRESHOLD (UNROLLED_NODE_CAPACITY / 2)
+
+// Defines a constant which will be used to check the string length of the
+// file name passed to load_data_from_file().
+#define MINIMUM_NAME_LENGTH 4
+
+// Defines a constant which will be used to indicate that a value was
+// successfully read from the input file in load_data_from_file().
+#define READ_SUCCESS 1
+
+// Internal function that prints a diagnostic message and aborts the program in
+// the unlikely event that memory allocation fails.
+static void internal_bad_alloc(void)
+{
+    fprintf(stderr, "Memory allocation failed!\n");
+    abort();
+}
+
+// Internal function that prints a diagnostic message and aborts the program if
+// the user attempts to access an index which is outside the bounds of the list.
+static void internal_out_of_bounds(size_t const size, size_t const index)
+{
+    fprintf(stderr, "Attempt to access index out of range!\n");
+    fprintf(stderr, "Index %zu of list with size %zu.\n", index, size);
+    abort();
+}
+
+// Definition for an unrolled linked list node.
+// Contains:
+// - Pointer to the `next` node.
+// - Pointer to the `previous` node.
+// - Number of integers currently stored in the node.
+// - Integer values being stored, in list order.
+typedef struct IntegerUnrolledNode
+{
+    struct IntegerUnrolledNode *next;
+    struct IntegerUnrolledNode *previous;
+    int count;
+    int data[UNROLLED_NODE_CAPACITY];
+} IntegerUnrolledNode;
+
+// Internal function that allocates an empty node, aborting the program if
+// allocation fails.
+static IntegerUnrolledNode *internal_allocate_node(void)
+{
+    // Allocate memory for the new node.
+    IntegerUnrolledNode *node = (IntegerUnrolledNode *)malloc(sizeof(IntegerUnrolledNode));
+
+    // If allocation fails, print a diagnostic message and abort the program.
+    if (!node) { internal_bad_alloc(); }
+
+    // A new node is not linked to any other node and holds no values.
+    node->next = NULL;
+    node->previous = NULL;
+    node->count = 0;
+
+    return node;
+}
+
+// Internal function that removes a node from the list and frees it.  The
+// element count of the list is not changed, callers only unlink empty nodes
+// or nodes whose values have already been moved elsewhere.
+static void internal_unlink_node(IntegerUnrolledList *list, IntegerUnrolledNode *node)
+{
+    // Point the neighbor before the node, or the head, past the node.
+    if (node->previous)
+    {
+        node->previous->next = node->next;
+    }
+    else
+    {
+        list->head = node->next;
+    }
+
+    // Point the neighbor after the node, or the tail, before the node.
+    if (node->next)
+    {
+        node->next->previous = node->previous;
+    }
+    else
+    {
+        list->tail = node->previous;
+    }
+
+    // The node is no longer reachable, free it.
+    free(node);
+}
+
+// Internal function that folds a sparse node into its successor or the
+// successor into the node when both fit in a single node, keeping the list
+// dense after removals.
+static void internal_merge_if_sparse(IntegerUnrolledList *list, IntegerUnrolledNode *node)
+{
+    // Empty nodes are simply removed.
+    if (node->count == 0)
+    {
+        internal_unlink_node(list, node);
+        return;
+    }
+
+    // Nodes that are at least half full are left alone.
+    if (node->count >= UNROLLED_MERGE_THRESHOLD) { return; }
+
+    // Merge with the following node if the combined values fit.
+    IntegerUnrolledNode *next = node->next;
+    if (next && node->count + next->count <= UNROLLED_NODE_CAPACITY)
+    {
+        memcpy(&node->data[node->count], next->data, (size_t)next->count * sizeof(int));
+        node->count += next->count;
+        internal_unlink_node(list, next);
+        return;
+    }
+
+    // Otherwise merge into the preceding node if the combined values fit.
+    IntegerUnrolledNode *previous = node->previous;
+    if (previous && previous->count + node->count <= UNROLLED_NODE_CAPACITY)
+    {
+        memcpy(&previous->data[previous->count], node->data, (size_t)node->count * sizeof(int));
+        previous->count += node->count;
+        internal_unlink_node(list, node);
+    }
+}
+
+// Internal function that finds the node holding the element at `index`,
+// walking from whichever end of the list is closer.  The position of the
+// element within the node is stored in `offset`.
+static IntegerUnrolledNode *internal_locate(IntegerUnrolledList const *list,
+                                            size_t const index, int *offset)
+{
+    // Elements in the front half are found by walking forward from the head.
+    if (index < list->size / 2)
+    {
+        IntegerUnrolledNode *node = list->head;
+        size_t remaining = index;
+
+        // Skip whole nodes until the remaining distance falls inside one.
+        while (remaining >= (size_t)node->count)
+        {
+            remaining -= (size_t)node->count;
+            node = node->next;
+        }
+
+        *offset = (int)remaining;
+        return node;
+    }
+
+    // Elements in the back half are found by walking backward from the tail,
+    // counting the distance from the end of the list.
+    IntegerUnrolledNode *node = list->tail;
+    size_t remaining = list->size - 1 - index;
+
+    // Skip whole nodes until the remaining distance falls inside one.
+    while (remaining >= (size_t)node->count)
+    {
+        remaining -= (size_t)node->count;
+        node = node->previous;
+    }
+
+    *offset = node->count - 1 - (int)remaining;
+    return node;
+}
+
+// Internal function that writes the size of the list followed by every
+// element through the formatter shared with linked_list.c.  Returns false if
+// writing to the stream failed.
+static bool internal_write_list(IntegerUnrolledList const *list, FILE *stream)
+{
+    // Prepare the buffer, aborting the program if allocation fails.
+    OutputBuffer buffer;
+    if (!output_buffer_open(&buffer, stream)) { internal_bad_alloc(); }
+
+    // Write the number of elements, then the values of every node in order.
+    output_buffer_begin_list(&buffer, list->size);
+    for (IntegerUnrolledNode const *node = list->head; node; node = node->next)
+    {
+        for (int i = 0; i < node->count; ++i)
+        {
+            output_buffer_append_element(&buffer, node->data[i]);
+        }
+    }
+    output_buffer_end_list(&buffer);
+
+    return output_buffer_close(&buffer);
+}
+
+
+// Initialize the unrolled linked list handle.
+bool unrolled_list_initialize(IntegerUnrolledList *list)
+{
+    // An empty list has no nodes and no elements.
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+
+    // Initialization success, return true.
+    return true;
+}
+
+// Populate the list with values from a file.
+void unrolled_list_load_data_from_file(IntegerUnrolledList *list, char const *fileName)
+{
+    // Ensure a file name is provided, and that it contains enough characters
+    // for the file extension plus at least one character for the file name.
+    // If not, print a diagnostic message and return early.
+    if (!fileName || strlen(fileName) < MINIMUM_NAME_LENGTH)
+    {
+        fprintf(stderr, "ERROR: Please provide the name of a text (.txt) file.\n");
+        return;
+    }
+
+    // Attempt to open a file of the provided name file for reading.
+    FILE *file = fopen(fileName, "r");
+
+    // If the file failed to open print a diagnostic message and return early.
+    if (!file)
+    {
+        fprintf(stderr, "ERROR: Unable to open %s file.\n", fileName);
+        return;
+    }
+
+    // Read every integer in the file, appending each to the list.
+    int value = 0;
+    while (fscanf(file, "%d", &value) == READ_SUCCESS)
+    {
+        unrolled_list_push_back(list, value);
+    }
+
+    // Close the file, releasing the resource back to the system.
+    fclose(file);
+}
+
+// Cleanup function that frees all allocated memory resources.
+void unrolled_list_cleanup(IntegerUnrolledList *list)
+{
+    unrolled_list_clear(list);
+}
+
+// Clears the list by freeing every node, then resets the handle.
+void unrolled_list_clear(IntegerUnrolledList *list)
+{
+    // Walk the nodes, storing `next` before each node is freed.
+    IntegerUnrolledNode *node = list->head;
+    while (node)
+    {
+        IntegerUnrolledNode *next = node->next;
+        free(node);
+        node = next;
+    }
+
+    // Reset the handle to the empty state.
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+}
+
+// Appends a value to the end of the list, only allocating a new node when the
+// last node is full.
+void unrolled_list_push_back(IntegerUnrolledList *list, int const value)
+{
+    // If the last node is missing or full, link a new node after it.
+    if (!list->tail || list->tail->count == UNROLLED_NODE_CAPACITY)
+    {
+        IntegerUnrolledNode *node = internal_allocate_node();
+        node->previous = list->tail;
+
+        if (list->tail)
+        {
+            list->tail->next = node;
+        }
+        else
+        {
+            list->head = node;
+        }
+
+        list->tail = node;
+    }
+
+    // Store the value after the last value of the last node.
+    list->tail->data[list->tail->count++] = value;
+    ++list->size;
+}
+
+// Prepends a value to the front of the list, only allocating a new node when
+// the first node is full.
+void unrolled_list_push_front(IntegerUnrolledList *list, int const value)
+{
+    // If the first node is missing or full, link a new node before it.
+    if (!list->head || list->head->count == UNROLLED_NODE_CAPACITY)
+    {
+        IntegerUnrolledNode *node = internal_allocate_node();
+        node->next = list->head;
+
+        if (list->head)
+        {
+            list->head->previous = node;
+        }
+        else
+        {
+            list->tail = node;
+        }
+
+        list->head = node;
+    }
+
+    // Shift the values of the first node up by one to make room at the front.
+    IntegerUnrolledNode *head = list->head;
+    memmove(&head->data[1], &head->data[0], (size_t)head->count * sizeof(int));
+    head->data[0] = value;
+    ++head->count;
+    ++list->size;
+}
+
+// Removes the last value in the list.
+void unrolled_list_pop_back(IntegerUnrolledList *list)
+{
+    // If the list is empty there is nothing to remove.
+    if (!list->tail) { return; }
+
+    // Drop the last value, and the last node once it is empty.
+    if (--list->tail->count == 0) { internal_unlink_node(list, list->tail); }
+    --list->size;
+}
+
+// Removes the first value in the list.
+void unrolled_list_pop_front(IntegerUnrolledList *list)
+{
+    // If the list is empty there is nothing to remove.
+    if (!list->head) { return; }
+
+    // Shift the remaining values of the first node down by one.
+    IntegerUnrolledNode *head = list->head;
+    --head->count;
+    memmove(&head->data[0], &head->data[1], (size_t)head->count * sizeof(int));
+
+    // Drop the first node once it is empty.
+    if (head->count == 0) { internal_unlink_node(list, head); }
+    --list->size;
+}
+
+// Removes the value at the specified index.
+void unrolled_list_remove_at_index(IntegerUnrolledList *list, size_t const index)
+{
+    // If the index passed as an argument is greater than the number of
+    // elements in the list, print a diagnostic message and abort.
+    if (index >= list->size) { internal_out_of_bounds(list->size, index); }
+
+    // Find the node holding the value and its position within that node.
+    int offset = 0;
+    IntegerUnrolledNode *node = internal_locate(list, index, &offset);
+
+    // Close the gap left by the removed value.
+    --node->count;
+    memmove(&node->data[offset], &node->data[offset + 1],
+            (size_t)(node->count - offset) * sizeof(int));
+    --list->size;
+
+    // Keep the list dense now that the node holds one value fewer.
+    internal_merge_if_sparse(list, node);
+}
+
+// Removes every occurrence of the specified value in a single pass, compacting
+// the surviving values of each node in place.
+void unrolled_list_remove_value(IntegerUnrolledList *list, int const value)
+{
+    IntegerUnrolledNode *node = list->head;
+
+    while (node)
+    {
+        // Store the next node, the current one may be merged away below.
+        IntegerUnrolledNode *next = node->next;
+
+        // Copy every value that is kept over the values that are removed.
+        int kept = 0;
+        for (int i = 0; i < node->count; ++i)
+        {
+            if (node->data[i] != value) { node->data[kept++] = node->data[i]; }
+        }
+
+        // Only touch the structure of the list if values were removed.
+        if (kept != node->count)
+        {
+            list->size -= (size_t)(node->count - kept);
+            node->count = kept;
+
+            // Merging backward only, the following node has not been
+            // filtered yet and must stay where the loop will find it.
+            if (kept == 0)
+            {
+                internal_unlink_node(list, node);
+            }
+            else if (node->previous &&
+                     node->previous->count + kept <= UNROLLED_NODE_CAPACITY)
+            {
+                IntegerUnrolledNode *previous = node->previous;
+                memcpy(&previous->data[previous->count], node->data, (size_t)kept * sizeof(int));
+                previous->count += kept;
+                internal_unlink_node(list, node);
+            }
+        }
+
+        node = next;
+    }
+}
+
+// Returns the value stored at the end of the list.
+int unrolled_list_back(IntegerUnrolledList const *list)
+{
+    return list->tail->data[list->tail->count - 1];
+}
+
+// Returns the value stored at the beginning of the list.
+int unrolled_list_front(IntegerUnrolledList const *list)
+{
+    return list->head->data[0];
+}
+
+// Returns the value stored at the specified index.
+int unrolled_list_element_at(IntegerUnrolledList const *list, size_t const index)
+{
+    // If the index passed as an argument is greater than the number of
+    // elements in the list, print a diagnostic message and abort.
+    if (index >= list->size) { internal_out_of_bounds(list->size, index); }
+
+    // Find the node holding the value and return it.
+    int offset = 0;
+    IntegerUnrolledNode *node = internal_locate(list, index, &offset);
+    return node->data[offset];
+}
+
+// Writes the contents of the list to a file, using the same format as
+// linked_list_output_to_file().
+void unrolled_list_output_to_file(IntegerUnrolledList *list, char const *fileName)
+{
+    // Ensure a file name is provided, and that it contains enough characters
+    // for the file extension plus at least one character for the file name.
+    // If not, print a diagnostic message and return early.
+    if (!fileName || strlen(fileName) < MINIMUM_NAME_LENGTH)
+    {
+        fprintf(stderr, "ERROR: Please provide the name of a text (.txt) file.\n");
+        return;
+    }
+
+    // Attempt to open a file of the provided name file for writing.
+    FILE *file = fopen(fileName, "w");
+
+    // If the file failed to open print a diagnostic message and return early.
+    if (!file)
+    {
+        fprintf(stderr, "ERROR: Unable to open %s file.\n", fileName);
+        return;
+    }
+
+    // Write every element through the shared formatter, reporting a
+    // diagnostic message if the file could not be written completely.
+    if (!internal_write_list(list, file))
+    {
+        fprintf(stderr, "ERROR: Unable to write %s file.\n", fileName);
+    }
+
+    // Close the file, releasing the resource back to the system.
+    fclose(file);
+}
+
+// Returns the index of the first value equal to the desired value if the
+// value exists in the list, otherwise the size of the list is returned.
+size_t unrolled_list_find_first_index_containing(IntegerUnrolledList const *list, int const value)
+{
+    // Index of the first value stored in the current node.
+    size_t base = 0;
+
+    for (IntegerUnrolledNode *node = list->head; node; node = node->next)
+    {
+        // Scan the values of the node, which are contiguous in memory.
+        for (int i = 0; i < node->count; ++i)
+        {
+            if (node->data[i] == value) { return base + (size_t)i; }
+        }
+
+        base += (size_t)node->count;
+    }
+
+    // Not found, `base` is now equal to the size of the list.
+    return base;
+}
+
+// Print the size of the list as well as each element in the list to stdout,
+// using the same format as linked_list_print_list().
+void unrolled_list_print_list(IntegerUnrolledList const *list)
+{
+    internal_write_list(list, stdout);
+}
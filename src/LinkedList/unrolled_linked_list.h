@@ -0,0 +1,69 @@
+/*
+* File Name: unrolled_linked_list.h
+* Purpose: Contains the public types and function declarations for my
+*          unrolled linked list implementation, a list whose nodes each
+*          store several integers.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_UNROLLED_LINKED_LIST_H
+#define BACHURSKI_UNROLLED_LINKED_LIST_H
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stdio.h>
+
+// Unrolled Linked List Handle
+// Contains:
+// - Pointer to the first node in the list.
+// - Pointer to the last node in the list.
+// - Number of elements in the list, not the number of nodes.
+typedef struct IntegerUnrolledList
+{
+    struct IntegerUnrolledNode *head;
+    struct IntegerUnrolledNode *tail;
+    size_t size;
+} IntegerUnrolledList;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying unrolled_linked_list.c
+    * file.  Comments only serve to separate declarations by their general
+    * purpose.
+*/
+
+// Initialization
+bool unrolled_list_initialize(IntegerUnrolledList *list);
+void unrolled_list_load_data_from_file(IntegerUnrolledList *list, char const *fileName);
+
+// Cleanup
+void unrolled_list_cleanup(IntegerUnrolledList *list);
+
+// Modifiers
+void unrolled_list_clear(IntegerUnrolledList *list);
+void unrolled_list_push_back(IntegerUnrolledList *list, int const value);
+void unrolled_list_push_front(IntegerUnrolledList *list, int const value);
+void unrolled_list_pop_back(IntegerUnrolledList *list);
+void unrolled_list_pop_front(IntegerUnrolledList *list);
+void unrolled_list_remove_at_index(IntegerUnrolledList *list, size_t const index);
+void unrolled_list_remove_value(IntegerUnrolledList *list, int const value);
+
+// Element Access
+int unrolled_list_back(IntegerUnrolledList const *list);
+int unrolled_list_front(IntegerUnrolledList const *list);
+int unrolled_list_element_at(IntegerUnrolledList const *list, size_t const index);
+
+// Output
+void unrolled_list_output_to_file(IntegerUnrolledList *list, char const *fileName);
+
+// Search
+size_t unrolled_list_find_first_index_containing(IntegerUnrolledList const *list, int const value);
+
+// Display
+void unrolled_list_print_list(IntegerUnrolledList const *list);
+
+// End of header guard.
+#endif
@@ -0,0 +1,344 @@
+/*
+* File Name: value_aggregates.c
+* Purpose: Contains constants and function definitions for the aggregates my
+*          linked list implementation can keep up to date as it changes.
+*
+*          The sum and the count of each value follow every insertion and
+*          removal directly.  The smallest and largest values are kept in two
+*          heaps of the distinct values, from which removed values are deleted
+*          lazily: a value whose count has dropped to zero is only popped once
+*          it reaches the top of a heap, so a removal never searches a heap.
+*          The removal that uncovers such a value pops it, which keeps a
+*          stored value at the top of both heaps, so the queries only read.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Include the header for the aggregates.
+#include "value_aggregates.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+// Defines a constant for the number of slots of a new table of value counts.
+#define INITIAL_CAPACITY 16
+
+// Internal function that maps a value to its preferred slot.  Multiplying by
+// a large odd constant spreads consecutive values across the table.
+static size_t internal_home_slot(ValueAggregates const *aggregates, int const value)
+{
+    unsigned long long hash = (unsigned long long)(unsigned)value * 0x9E3779B97F4A7C15ULL;
+    return (size_t)(hash >> 32) & (aggregates->capacity - 1);
+}
+
+// Internal function that returns the slot holding `value`, or the empty slot
+// where it would be inserted.
+static ValueCountSlot *internal_find_slot(ValueAggregates const *aggregates, int const value)
+{
+    size_t const mask = aggregates->capacity - 1;
+    size_t position = internal_home_slot(aggregates, value);
+
+    // Probe forward until the value or an empty slot is found.
+    while (aggregates->slots[position].occupied && aggregates->slots[position].value != value)
+    {
+        position = (position + 1) & mask;
+    }
+
+    return &aggregates->slots[position];
+}
+
+// Internal function that doubles the number of slots, moving every occupied
+// slot to its position in the new table.  Returns false if allocation fails.
+static bool internal_grow(ValueAggregates *aggregates)
+{
+    ValueCountSlot *oldSlots = aggregates->slots;
+    size_t const oldCapacity = aggregates->capacity;
+
+    // Allocate the new, empty, table.
+    ValueCountSlot *slots = (ValueCountSlot *)calloc(oldCapacity * 2, sizeof(ValueCountSlot));
+    if (!slots) { return false; }
+
+    aggregates->slots = slots;
+    aggregates->capacity = oldCapacity * 2;
+
+    for (size_t i = 0; i < oldCapacity; ++i)
+    {
+        if (oldSlots[i].occupied)
+        {
+            *internal_find_slot(aggregates, oldSlots[i].value) = oldSlots[i];
+        }
+    }
+
+    free(oldSlots);
+    return true;
+}
+
+// Internal function that empties the slot at `position`, shifting later slots
+// of the same probe run back so that no lookup stops early at the hole.
+static void internal_erase_slot(ValueAggregates *aggregates, size_t position)
+{
+    size_t const mask = aggregates->capacity - 1;
+    size_t next = position;
+
+    while (true)
+    {
+        next = (next + 1) & mask;
+        if (!aggregates->slots[next].occupied) { break; }
+
+        // A slot may fill the hole only if its home slot is not between the
+        // hole and the slot itself, taking wrap around into account.
+        size_t const home = internal_home_slot(aggregates, aggregates->slots[next].value);
+        bool const movable = (position <= next) ? (home <= position || home > next)
+                                                : (home <= position && home > next);
+        if (movable)
+        {
+            aggregates->slots[position] = aggregates->slots[next];
+            position = next;
+        }
+    }
+
+    // The final hole becomes an empty slot.
+    aggregates->slots[position].occupied = false;
+    aggregates->slots[position].count = 0;
+    --aggregates->occupied;
+}
+
+// Internal function that returns true if `first` belongs above `second` in a
+// heap ordered largest first, or smallest first.
+static bool internal_heap_before(int const first, int const second, bool const largestFirst)
+{
+    return largestFirst ? first > second : first < second;
+}
+
+// Internal function that makes room in a heap for one more value, doubling
+// its array when full.  Returns false if allocation fails.
+static bool internal_heap_reserve(ValueHeap *heap)
+{
+    if (heap->size < heap->capacity) { return true; }
+
+    size_t const capacity = heap->capacity ? heap->capacity * 2 : INITIAL_CAPACITY;
+    int *values = (int *)realloc(heap->values, capacity * sizeof(int));
+    if (!values) { return false; }
+
+    heap->values = values;
+    heap->capacity = capacity;
+    return true;
+}
+
+// Internal function that adds a value to a heap with room for it, moving it
+// up past every value it belongs above.
+static void internal_heap_push(ValueHeap *heap, int const value, bool const largestFirst)
+{
+    size_t position = heap->size++;
+
+    while (position > 0)
+    {
+        size_t const parent = (position - 1) / 2;
+        if (!internal_heap_before(value, heap->values[parent], largestFirst)) { break; }
+
+        heap->values[position] = heap->values[parent];
+        position = parent;
+    }
+
+    heap->values[position] = value;
+}
+
+// Internal function that removes the top value of a heap, moving the last
+// value down from the top until the order holds again.
+static void internal_heap_pop(ValueHeap *heap, bool const largestFirst)
+{
+    int const value = heap->values[--heap->size];
+    size_t position = 0;
+
+    while (true)
+    {
+        size_t child = position * 2 + 1;
+        if (child >= heap->size) { break; }
+
+        // Follow whichever child belongs higher.
+        if (child + 1 < heap->size &&
+            internal_heap_before(heap->values[child + 1], heap->values[child], largestFirst))
+        {
+            ++child;
+        }
+
+        if (!internal_heap_before(heap->values[child], value, largestFirst)) { break; }
+
+        heap->values[position] = heap->values[child];
+        position = child;
+    }
+
+    if (heap->size > 0) { heap->values[position] = value; }
+}
+
+// Internal function that pops every value whose count has dropped to zero
+// from the top of a heap, so that the top is a value still stored by a node,
+// or the heap is empty.
+static void internal_heap_settle(ValueAggregates const *aggregates, ValueHeap *heap,
+                                 bool const largestFirst)
+{
+    while (heap->size > 0 && !internal_find_slot(aggregates, heap->values[0])->occupied)
+    {
+        internal_heap_pop(heap, largestFirst);
+    }
+}
+
+// Internal function that rebuilds both heaps from the distinct values, once
+// values removed but not yet popped make up most of the heaps.  The heaps
+// shrink, so the rebuild has room for every value.
+static void internal_rebuild_heaps(ValueAggregates *aggregates)
+{
+    aggregates->smallest.size = 0;
+    aggregates->largest.size = 0;
+
+    for (size_t i = 0; i < aggregates->capacity; ++i)
+    {
+        if (aggregates->slots[i].occupied)
+        {
+            internal_heap_push(&aggregates->smallest, aggregates->slots[i].value, false);
+            internal_heap_push(&aggregates->largest, aggregates->slots[i].value, true);
+        }
+    }
+}
+
+// Creates empty aggregates.  Returns null if allocation fails.
+ValueAggregates *value_aggregates_create(void)
+{
+    ValueAggregates *aggregates = (ValueAggregates *)malloc(sizeof(ValueAggregates));
+    if (!aggregates) { return NULL; }
+
+    aggregates->slots = (ValueCountSlot *)calloc(INITIAL_CAPACITY, sizeof(ValueCountSlot));
+    if (!aggregates->slots)
+    {
+        free(aggregates);
+        return NULL;
+    }
+
+    aggregates->sum = 0;
+    aggregates->capacity = INITIAL_CAPACITY;
+    aggregates->occupied = 0;
+    aggregates->smallest.values = NULL;
+    aggregates->smallest.size = 0;
+    aggregates->smallest.capacity = 0;
+    aggregates->largest.values = NULL;
+    aggregates->largest.size = 0;
+    aggregates->largest.capacity = 0;
+
+    return aggregates;
+}
+
+// Releases the aggregates and every array they own.
+void value_aggregates_destroy(ValueAggregates *aggregates)
+{
+    // Destroying null aggregates is a no-op, mirroring free().
+    if (!aggregates) { return; }
+
+    free(aggregates->slots);
+    free(aggregates->smallest.values);
+    free(aggregates->largest.values);
+    free(aggregates);
+}
+
+// Removes every value from the aggregates, keeping their arrays for reuse.
+void value_aggregates_clear(ValueAggregates *aggregates)
+{
+    for (size_t i = 0; i < aggregates->capacity; ++i)
+    {
+        aggregates->slots[i].occupied = false;
+        aggregates->slots[i].count = 0;
+    }
+
+    aggregates->sum = 0;
+    aggregates->occupied = 0;
+    aggregates->smallest.size = 0;
+    aggregates->largest.size = 0;
+}
+
+// Records that a node stores `value`.  Returns false if allocation fails.
+bool value_aggregates_insert(ValueAggregates *aggregates, int const value)
+{
+    // Keep the table at most three quarters full so probe runs stay short.
+    if ((aggregates->occupied + 1) * 4 > aggregates->capacity * 3 && !internal_grow(aggregates))
+    {
+        return false;
+    }
+
+    ValueCountSlot *slot = internal_find_slot(aggregates, value);
+
+    // A new distinct value joins both heaps, once both have room for it so
+    // that a failed allocation leaves the heaps unchanged.
+    if (!slot->occupied)
+    {
+        if (!internal_heap_reserve(&aggregates->smallest) ||
+            !internal_heap_reserve(&aggregates->largest))
+        {
+            return false;
+        }
+
+        internal_heap_push(&aggregates->smallest, value, false);
+        internal_heap_push(&aggregates->largest, value, true);
+
+        slot->occupied = true;
+        slot->value = value;
+        slot->count = 0;
+        ++aggregates->occupied;
+
+        // Drop removed values from the heaps once they outnumber the rest.
+        if (aggregates->smallest.size > aggregates->occupied * 2 + INITIAL_CAPACITY ||
+            aggregates->largest.size > aggregates->occupied * 2 + INITIAL_CAPACITY)
+        {
+            internal_rebuild_heaps(aggregates);
+        }
+    }
+
+    ++slot->count;
+    aggregates->sum += value;
+    return true;
+}
+
+// Forgets that a node stores `value`.  The value must have been inserted.
+void value_aggregates_remove(ValueAggregates *aggregates, int const value)
+{
+    ValueCountSlot *slot = internal_find_slot(aggregates, value);
+
+    aggregates->sum -= value;
+
+    // A value no node stores leaves the table, and the heaps lazily.  If it
+    // was the top of a heap, it is popped along with any removed values
+    // below it, each value popped at most once.
+    if (--slot->count == 0)
+    {
+        internal_erase_slot(aggregates, (size_t)(slot - aggregates->slots));
+        internal_heap_settle(aggregates, &aggregates->smallest, false);
+        internal_heap_settle(aggregates, &aggregates->largest, true);
+    }
+}
+
+// Returns the sum of every value.
+long long value_aggregates_sum(ValueAggregates const *aggregates)
+{
+    return aggregates->sum;
+}
+
+// Returns the number of nodes storing `value`.
+size_t value_aggregates_count(ValueAggregates const *aggregates, int const value)
+{
+    return internal_find_slot(aggregates, value)->count;
+}
+
+// Returns the smallest value.  At least one value must have been inserted
+// and not removed.
+int value_aggregates_minimum(ValueAggregates const *aggregates)
+{
+    return aggregates->smallest.values[0];
+}
+
+// Returns the largest value.  At least one value must have been inserted and
+// not removed.
+int value_aggregates_maximum(ValueAggregates const *aggregates)
+{
+    return aggregates->largest.values[0];
+}
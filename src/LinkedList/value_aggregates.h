@@ -0,0 +1,85 @@
+/*
+* File Name: value_aggregates.h
+* Purpose: Contains the private type and function declarations for the
+*          aggregates my linked list implementation can keep up to date as it
+*          changes: the sum, the smallest and largest value, and the number of
+*          nodes storing each value.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_VALUE_AGGREGATES_H
+#define BACHURSKI_VALUE_AGGREGATES_H
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+
+// Definition for a slot of the table of value counts.
+// Contains:
+// - Whether the slot holds a value.
+// - The value.
+// - Number of nodes storing the value.
+typedef struct ValueCountSlot
+{
+    bool occupied;
+    int value;
+    size_t count;
+} ValueCountSlot;
+
+// Definition for a binary heap of values, ordered smallest first or largest
+// first.
+// Contains:
+// - Pointer to the array of values, the top of the heap first.
+// - Number of values in the heap, and the capacity of the array.
+typedef struct ValueHeap
+{
+    int *values;
+    size_t size;
+    size_t capacity;
+} ValueHeap;
+
+// Definition for the aggregates.
+// Contains:
+// - Sum of every value.
+// - Table of value counts, an open addressing hash table with linear probing,
+//   its number of slots, always a power of two, and the number of occupied
+//   slots, the number of distinct values.
+// - Heaps of the distinct values, smallest first and largest first.  A value
+//   whose count drops to zero stays in the heaps until it reaches the top,
+//   where the removal that uncovers it pops it.
+typedef struct ValueAggregates
+{
+    long long sum;
+    ValueCountSlot *slots;
+    size_t capacity;
+    size_t occupied;
+    ValueHeap smallest;
+    ValueHeap largest;
+} ValueAggregates;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying value_aggregates.c
+    * file.
+*/
+
+// Lifetime
+ValueAggregates *value_aggregates_create(void);
+void value_aggregates_destroy(ValueAggregates *aggregates);
+void value_aggregates_clear(ValueAggregates *aggregates);
+
+// Maintenance
+bool value_aggregates_insert(ValueAggregates *aggregates, int const value);
+void value_aggregates_remove(ValueAggregates *aggregates, int const value);
+
+// Queries
+long long value_aggregates_sum(ValueAggregates const *aggregates);
+size_t value_aggregates_count(ValueAggregates const *aggregates, int const value);
+int value_aggregates_minimum(ValueAggregates const *aggregates);
+int value_aggregates_maximum(ValueAggregates const *aggregates);
+
+// End of header guard.
+#endif
@@ -0,0 +1,351 @@
+/*
+* File Name: value_index.c
+* Purpose: Contains constants and function definitions for the hash index my
+*          linked list implementation can keep from each value to the nodes
+*          storing it.
+*
+*          The first node storing a value is kept in the slot of the value,
+*          any further nodes in an array owned by the slot.  A second table
+*          maps each node of such an array to its index in the array, so a
+*          node is removed by moving the last node of the array into its
+*          place, however many nodes store the same value.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Include the header for the value index.
+#include "value_index.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// Defines a constant for the number of slots of a new index.
+#define INITIAL_CAPACITY 16
+
+// Internal function that maps a value to its preferred slot.  Multiplying by
+// a large odd constant spreads consecutive values across the table.
+static size_t internal_home_slot(ValueIndex const *index, int const value)
+{
+    unsigned long long hash = (unsigned long long)(unsigned)value * 0x9E3779B97F4A7C15ULL;
+    return (size_t)(hash >> 32) & (index->capacity - 1);
+}
+
+// Internal function that returns the slot holding `value`, or the empty slot
+// where it would be inserted.
+static ValueIndexSlot *internal_find_slot(ValueIndex const *index, int const value)
+{
+    size_t const mask = index->capacity - 1;
+    size_t position = internal_home_slot(index, value);
+
+    // Probe forward until the value or an empty slot is found.
+    while (index->slots[position].occupied && index->slots[position].value != value)
+    {
+        position = (position + 1) & mask;
+    }
+
+    return &index->slots[position];
+}
+
+// Internal function that doubles the number of slots, moving every occupied
+// slot to its position in the new table.  Returns false if allocation fails.
+static bool internal_grow(ValueIndex *index)
+{
+    ValueIndexSlot *oldSlots = index->slots;
+    size_t const oldCapacity = index->capacity;
+
+    // Allocate the new, empty, table.
+    ValueIndexSlot *slots = (ValueIndexSlot *)calloc(oldCapacity * 2, sizeof(ValueIndexSlot));
+    if (!slots) { return false; }
+
+    index->slots = slots;
+    index->capacity = oldCapacity * 2;
+
+    // Move each slot, its node arrays move along with it.
+    for (size_t i = 0; i < oldCapacity; ++i)
+    {
+        if (oldSlots[i].occupied)
+        {
+            *internal_find_slot(index, oldSlots[i].value) = oldSlots[i];
+        }
+    }
+
+    free(oldSlots);
+    return true;
+}
+
+// Internal function that empties the slot at `position`, shifting later slots
+// of the same probe run back so that no lookup stops early at the hole.
+static void internal_erase_slot(ValueIndex *index, size_t position)
+{
+    size_t const mask = index->capacity - 1;
+    size_t next = position;
+
+    free(index->slots[position].others);
+
+    while (true)
+    {
+        next = (next + 1) & mask;
+        if (!index->slots[next].occupied) { break; }
+
+        // A slot may fill the hole only if its home slot is not between the
+        // hole and the slot itself, taking wrap around into account.
+        size_t const home = internal_home_slot(index, index->slots[next].value);
+        bool const movable = (position <= next) ? (home <= position || home > next)
+                                                : (home <= position && home > next);
+        if (movable)
+        {
+            index->slots[position] = index->slots[next];
+            position = next;
+        }
+    }
+
+    // The final hole becomes an empty slot.
+    index->slots[position].occupied = false;
+    index->slots[position].others = NULL;
+    index->slots[position].othersCapacity = 0;
+    index->slots[position].count = 0;
+    index->slots[position].first = NULL;
+    --index->occupied;
+}
+
+// Internal function that maps a node to its preferred entry of the table of
+// positions.  The low bits of a node's address are the same for every node,
+// so the address is spread across the table like a value.
+static size_t internal_home_position(ValueIndex const *index, IntegerNode const *node)
+{
+    unsigned long long hash = (unsigned long long)(uintptr_t)node * 0x9E3779B97F4A7C15ULL;
+    return (size_t)(hash >> 32) & (index->positionsCapacity - 1);
+}
+
+// Internal function that returns the entry holding `node`, or the empty
+// entry where it would be inserted.
+static ValueIndexPosition *internal_find_position(ValueIndex const *index,
+                                                  IntegerNode const *node)
+{
+    size_t const mask = index->positionsCapacity - 1;
+    size_t position = internal_home_position(index, node);
+
+    // Probe forward until the node or an empty entry is found.
+    while (index->positions[position].node && index->positions[position].node != node)
+    {
+        position = (position + 1) & mask;
+    }
+
+    return &index->positions[position];
+}
+
+// Internal function that makes room for one more entry in the table of
+// positions, doubling it when it would become more than three quarters full.
+// Returns false if allocation fails.
+static bool internal_reserve_position(ValueIndex *index)
+{
+    if ((index->positionsOccupied + 1) * 4 <= index->positionsCapacity * 3) { return true; }
+
+    ValueIndexPosition *oldPositions = index->positions;
+    size_t const oldCapacity = index->positionsCapacity;
+
+    // Allocate the new, empty, table.
+    ValueIndexPosition *positions =
+        (ValueIndexPosition *)calloc(oldCapacity * 2, sizeof(ValueIndexPosition));
+    if (!positions) { return false; }
+
+    index->positions = positions;
+    index->positionsCapacity = oldCapacity * 2;
+
+    for (size_t i = 0; i < oldCapacity; ++i)
+    {
+        if (oldPositions[i].node)
+        {
+            *internal_find_position(index, oldPositions[i].node) = oldPositions[i];
+        }
+    }
+
+    free(oldPositions);
+    return true;
+}
+
+// Internal function that empties the entry of the table of positions holding
+// `node`, shifting later entries of the same probe run back like
+// internal_erase_slot().
+static void internal_erase_position(ValueIndex *index, IntegerNode const *node)
+{
+    size_t const mask = index->positionsCapacity - 1;
+    size_t position = (size_t)(internal_find_position(index, node) - index->positions);
+    size_t next = position;
+
+    while (true)
+    {
+        next = (next + 1) & mask;
+        if (!index->positions[next].node) { break; }
+
+        size_t const home = internal_home_position(index, index->positions[next].node);
+        bool const movable = (position <= next) ? (home <= position || home > next)
+                                                : (home <= position && home > next);
+        if (movable)
+        {
+            index->positions[position] = index->positions[next];
+            position = next;
+        }
+    }
+
+    // The final hole becomes an empty entry.
+    index->positions[position].node = NULL;
+    --index->positionsOccupied;
+}
+
+// Creates an empty index.  Returns null if allocation fails.
+ValueIndex *value_index_create(void)
+{
+    ValueIndex *index = (ValueIndex *)malloc(sizeof(ValueIndex));
+    if (!index) { return NULL; }
+
+    index->slots = (ValueIndexSlot *)calloc(INITIAL_CAPACITY, sizeof(ValueIndexSlot));
+    index->positions = (ValueIndexPosition *)calloc(INITIAL_CAPACITY, sizeof(ValueIndexPosition));
+    if (!index->slots || !index->positions)
+    {
+        free(index->slots);
+        free(index->positions);
+        free(index);
+        return NULL;
+    }
+
+    index->capacity = INITIAL_CAPACITY;
+    index->occupied = 0;
+    index->positionsCapacity = INITIAL_CAPACITY;
+    index->positionsOccupied = 0;
+
+    return index;
+}
+
+// Releases the index and every array it owns.
+void value_index_destroy(ValueIndex *index)
+{
+    // Destroying a null index is a no-op, mirroring free().
+    if (!index) { return; }
+
+    value_index_clear(index);
+    free(index->slots);
+    free(index->positions);
+    free(index);
+}
+
+// Removes every value from the index, keeping its slots for reuse.
+void value_index_clear(ValueIndex *index)
+{
+    for (size_t i = 0; i < index->capacity; ++i)
+    {
+        free(index->slots[i].others);
+        index->slots[i].occupied = false;
+        index->slots[i].others = NULL;
+        index->slots[i].othersCapacity = 0;
+        index->slots[i].count = 0;
+        index->slots[i].first = NULL;
+    }
+
+    for (size_t i = 0; i < index->positionsCapacity; ++i) { index->positions[i].node = NULL; }
+
+    index->occupied = 0;
+    index->positionsOccupied = 0;
+}
+
+// Records that `node` stores its value.  Returns false if allocation fails.
+bool value_index_insert(ValueIndex *index, IntegerNode *node)
+{
+    // Keep the table at most three quarters full so probe runs stay short.
+    if ((index->occupied + 1) * 4 > index->capacity * 3 && !internal_grow(index))
+    {
+        return false;
+    }
+
+    ValueIndexSlot *slot = internal_find_slot(index, node->data);
+
+    // The first node storing a value is kept inline in a new slot.
+    if (!slot->occupied)
+    {
+        slot->occupied = true;
+        slot->value = node->data;
+        slot->count = 1;
+        slot->first = node;
+        slot->others = NULL;
+        slot->othersCapacity = 0;
+        ++index->occupied;
+        return true;
+    }
+
+    // Further nodes are appended to the array, doubling it when full, and
+    // their position recorded.
+    if (!internal_reserve_position(index)) { return false; }
+
+    if (slot->count - 1 == slot->othersCapacity)
+    {
+        size_t const capacity = slot->othersCapacity ? slot->othersCapacity * 2 : 4;
+        IntegerNode **others = (IntegerNode **)realloc(slot->others, capacity * sizeof(IntegerNode *));
+        if (!others) { return false; }
+
+        slot->others = others;
+        slot->othersCapacity = capacity;
+    }
+
+    ValueIndexPosition *entry = internal_find_position(index, node);
+    entry->node = node;
+    entry->position = slot->count - 1;
+    ++index->positionsOccupied;
+
+    slot->others[slot->count - 1] = node;
+    ++slot->count;
+    return true;
+}
+
+// Forgets that `node` stores its value.  The node must have been inserted.
+void value_index_remove(ValueIndex *index, IntegerNode const *node)
+{
+    ValueIndexSlot *slot = internal_find_slot(index, node->data);
+
+    // Removing the only node of a value frees its slot.
+    if (slot->count == 1)
+    {
+        internal_erase_slot(index, (size_t)(slot - index->slots));
+        return;
+    }
+
+    // Otherwise the last array entry replaces the removed node, either the
+    // inline node, which leaves the array, or the entry recorded for the
+    // node, which the last entry's position then follows.
+    IntegerNode *last = slot->others[slot->count - 2];
+    if (slot->first == node)
+    {
+        slot->first = last;
+        internal_erase_position(index, last);
+    }
+    else
+    {
+        size_t const position = internal_find_position(index, node)->position;
+        internal_erase_position(index, node);
+
+        if (last != node)
+        {
+            slot->others[position] = last;
+            internal_find_position(index, last)->position = position;
+        }
+    }
+
+    --slot->count;
+}
+
+// Returns the number of nodes storing `value`.
+size_t value_index_count(ValueIndex const *index, int const value)
+{
+    ValueIndexSlot const *slot = internal_find_slot(index, value);
+    return slot->occupied ? slot->count : 0;
+}
+
+// Returns one of the nodes storing `value`, or null if there is none.
+IntegerNode *value_index_any(ValueIndex const *index, int const value)
+{
+    ValueIndexSlot const *slot = internal_find_slot(index, value);
+    return slot->occupied ? slot->first : NULL;
+}
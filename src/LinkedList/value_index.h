@@ -0,0 +1,90 @@
+/*
+* File Name: value_index.h
+* Purpose: Contains the private type and function declarations for the hash
+*          index my linked list implementation can keep from each value to
+*          the nodes storing it.
+*
+* Author: Austin Bachurski
+* Date: 10/17/2026
+*/
+
+// Header guard.
+#ifndef BACHURSKI_VALUE_INDEX_H
+#define BACHURSKI_VALUE_INDEX_H
+
+// Include the node definition of the integer list.
+#include "linked_list.h"
+
+// Include required stdlib headers.
+#include <stdbool.h>
+#include <stddef.h>
+
+// Definition for a slot of the index.
+// Contains:
+// - Whether the slot holds a value.
+// - Value stored by every node of the slot.
+// - Number of nodes storing the value.
+// - The first node storing the value, kept inline so that unique values do
+//   not need a separate allocation.
+// - Array holding the remaining nodes, and its capacity.
+typedef struct ValueIndexSlot
+{
+    bool occupied;
+    int value;
+    size_t count;
+    IntegerNode *first;
+    IntegerNode **others;
+    size_t othersCapacity;
+} ValueIndexSlot;
+
+// Definition for the position of a node in the array of remaining nodes of
+// its slot.
+// Contains:
+// - The node, or null if the entry is empty.
+// - Index of the node in the array.
+typedef struct ValueIndexPosition
+{
+    IntegerNode const *node;
+    size_t position;
+} ValueIndexPosition;
+
+// Definition for the index, an open addressing hash table with linear
+// probing.
+// Contains:
+// - Pointer to the array of slots.
+// - Number of slots, always a power of two.
+// - Number of occupied slots, the number of distinct values.
+// - Second table of the same kind, from each node held in an array of
+//   remaining nodes to its index in that array, so that removing a node never
+//   searches the array.  Its number of entries, always a power of two, and
+//   the number of entries in use.
+typedef struct ValueIndex
+{
+    ValueIndexSlot *slots;
+    size_t capacity;
+    size_t occupied;
+    ValueIndexPosition *positions;
+    size_t positionsCapacity;
+    size_t positionsOccupied;
+} ValueIndex;
+
+/*
+    * Descriptive comments for the remaining declarations in this file are
+    * included with the definition in the accompanying value_index.c file.
+*/
+
+// Lifetime
+ValueIndex *value_index_create(void);
+void value_index_destroy(ValueIndex *index);
+void value_index_clear(ValueIndex *index);
+
+// Maintenance
+bool value_index_insert(ValueIndex *index, IntegerNode *node);
+void value_index_remove(ValueIndex *index, IntegerNode const *node);
+
+// Queries
+size_t value_index_count(ValueIndex const *index, int const value);
+IntegerNode *value_index_any(ValueIndex const *index, int const value);
+
+// End of header guard.
+#endif